@@ -456,7 +456,8 @@ SCIP_RETCODE solvePricingHeuristic(
    /* main loop */
    while( niters < iterlim
       && SCIPgetTotalTime(scip) - timestart <= timelim
-      && !SCIPisStopped(scip) )
+      && !SCIPisStopped(scip)
+      && !SCIPhasEnoughPricedVars(scip) )
    {
       SCIP_Real redcosts = 1.0;
       SCIP_Real vol = 0.0;
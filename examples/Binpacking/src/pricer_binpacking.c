@@ -51,7 +51,8 @@
  * To solve the above integer program, we create a new SCIP instance within SCIP and use the usual functions to create
  * variables and constraints. Besides, we need the current dual solutions to all set covering constraints (each stands
  * for one item) which are the objective coefficients of the binary variables. Therefore, we use the function
- * SCIPgetDualsolSetppc() which returns the dual solutions for the given set covering constraint.
+ * SCIPgetRowPricingDualsol() on the LP row of each set covering constraint, which returns its dual solution or, if the
+ * parameter pricing/smoothing is set, the smoothed dual solution.
  *
  * Since we also want to generate new variables during search, we have to care that we do not generate variables over
  * and over again. For example, if we branched or fixed a certain packing to zero, we have to make sure that we do not
@@ -345,6 +346,7 @@ SCIP_RETCODE initPricing(
    SCIP_CONS** conss;
    SCIP_Longint* vals;
    SCIP_CONS* cons;
+   SCIP_ROW* row;
    SCIP_VAR* var;
    SCIP_Longint* weights;
    SCIP_Longint capacity;
@@ -386,8 +388,9 @@ SCIP_RETCODE initPricing(
          continue;
       }
 
-      /* dual value in original SCIP */
-      dual = SCIPgetDualsolSetppc(scip, cons);
+      /* dual value in original SCIP, smoothed if pricing/smoothing is set */
+      row = SCIPgetRowSetppc(scip, cons);
+      dual = (row != NULL ? SCIPgetRowPricingDualsol(scip, row) : SCIPgetDualsolSetppc(scip, cons));
       
       SCIP_CALL( SCIPcreateVarBasic(subscip, &var, SCIPconsGetName(cons), 0.0, 1.0, dual, SCIP_VARTYPE_BINARY) );
       SCIP_CALL( SCIPaddVar(subscip, var) );
@@ -583,9 +586,9 @@ SCIP_DECL_PRICERREDCOST(pricerRedcostBinpacking)
    addvar = FALSE;
 
    /* loop over all solutions and create the corresponding column to master if the reduced cost are negative for master,
-    * that is the objective value i greater than 1.0
+    * that is the objective value i greater than 1.0; stop early if enough columns were priced in this round
     */
-   for( s = 0; s < nsols; ++s )
+   for( s = 0; s < nsols && !SCIPhasEnoughPricedVars(scip); ++s )
    {
       SCIP_Bool feasible;
       SCIP_SOL* sol;
@@ -76,6 +76,10 @@
 #define SCIP_DEFAULT_MAXSLACKVARCOEF       1e+9  /** the maximal objective coefficient of the slack variables in the subproblem */
 #define SCIP_DEFAULT_CHECKCONSCONVEXITY    TRUE  /** should the constraints of the subproblem be checked for convexity? */
 #define SCIP_DEFAULT_NLPITERLIMIT         10000  /** iteration limit for NLP solver */
+#define SCIP_DEFAULT_DEDUPCUTS            FALSE  /** should near-duplicate cuts be detected and replaced by previous cuts? */
+#define SCIP_DEFAULT_DEDUPMEMSIZE          1000  /** the maximal number of recently added cuts kept for duplicate detection */
+#define SCIP_DEFAULT_DEDUPMAXPARALL      0.9999  /** minimal parallelism for a cut to be considered a duplicate */
+#define SCIP_DEFAULT_CUTAGGRSIZE              1  /** number of subproblems whose optimality cuts are aggregated (1: multi-cut) */
 
 #define BENDERS_MAXPSEUDOSOLS                 5  /** the maximum number of pseudo solutions checked before suggesting
                                                   *  merge candidates */
@@ -1198,6 +1202,26 @@ SCIP_RETCODE doBendersCreate(
          "iteration limit for NLP solver", &(*benders)->nlpparam.iterlimit, FALSE,
          SCIP_DEFAULT_NLPITERLIMIT, 0, INT_MAX, NULL, NULL) ); /*lint !e740*/
 
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/dedupcuts", name);
+   SCIP_CALL( SCIPsetAddBoolParam(set, messagehdlr, blkmem, paramname,
+         "should near-duplicates of recently added cuts be detected and the previous cut be reused instead?",
+         &(*benders)->dedupcutsenabled, FALSE, SCIP_DEFAULT_DEDUPCUTS, NULL, NULL) ); /*lint !e740*/
+
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/dedupmemsize", name);
+   SCIP_CALL( SCIPsetAddIntParam(set, messagehdlr, blkmem, paramname,
+         "the maximal number of recently added cuts kept for duplicate detection (the oldest cuts are replaced first)",
+         &(*benders)->dedupmemsize, TRUE, SCIP_DEFAULT_DEDUPMEMSIZE, 1, INT_MAX, NULL, NULL) ); /*lint !e740*/
+
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/dedupmaxparall", name);
+   SCIP_CALL( SCIPsetAddRealParam(set, messagehdlr, blkmem, paramname,
+         "minimal parallelism for a cut to be considered a duplicate of a recently added cut", &(*benders)->dedupmaxparall,
+         TRUE, SCIP_DEFAULT_DEDUPMAXPARALL, 0.0, 1.0, NULL, NULL) ); /*lint !e740*/
+
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/cutaggrsize", name);
+   SCIP_CALL( SCIPsetAddIntParam(set, messagehdlr, blkmem, paramname,
+         "the number of consecutive subproblems whose optimality cuts are summed up to a single cut (1: one cut per subproblem, i.e. multi-cut; values of at least the number of subproblems give a single aggregated cut)",
+         &(*benders)->cutaggrsize, FALSE, SCIP_DEFAULT_CUTAGGRSIZE, 1, INT_MAX, NULL, NULL) ); /*lint !e740*/
+
    return SCIP_OKAY;
 }
 
@@ -2004,6 +2028,8 @@ SCIP_RETCODE SCIPbendersInit(
       benders->ncalls = 0;
       benders->ncutsfound = 0;
       benders->ntransferred = 0;
+      benders->ndupcuts = 0;
+      benders->naggregatedcuts = 0;
    }
 
    /* start timing */
@@ -2468,6 +2494,171 @@ SCIP_RETCODE SCIPbendersInitsol(
    return SCIP_OKAY;
 }
 
+/** frees a single entry of the rotating cut memory and releases the referenced row or constraint */
+static
+SCIP_RETCODE freeDedupCut(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_BENDERSDEDUPCUT** dedupcut           /**< the cut memory entry to free */
+   )
+{
+   assert(dedupcut != NULL);
+   assert(*dedupcut != NULL);
+
+   if( (*dedupcut)->row != NULL )
+   {
+      SCIP_CALL( SCIPreleaseRow(set->scip, &(*dedupcut)->row) );
+   }
+
+   if( (*dedupcut)->cons != NULL )
+   {
+      SCIP_CALL( SCIPreleaseCons(set->scip, &(*dedupcut)->cons) );
+   }
+
+   SCIPfreeBlockMemoryArray(set->scip, &(*dedupcut)->vals, (*dedupcut)->nvars);
+   SCIPfreeBlockMemoryArray(set->scip, &(*dedupcut)->varinds, (*dedupcut)->nvars);
+   SCIPfreeBlockMemory(set->scip, dedupcut);
+
+   return SCIP_OKAY;
+}
+
+/** frees the rotating cut memory used for duplicate detection */
+static
+SCIP_RETCODE freeDedupCuts(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int i;
+
+   assert(benders != NULL);
+
+   if( benders->dedupcuts == NULL )
+      return SCIP_OKAY;
+
+   for( i = benders->ndedupcuts - 1; i >= 0; i-- )
+   {
+      SCIP_CALL( freeDedupCut(set, &benders->dedupcuts[i]) );
+   }
+
+   BMSfreeBlockMemoryArray(SCIPblkmem(set->scip), &benders->dedupcuts, benders->dedupcutssize);
+   benders->dedupcutssize = 0;
+   benders->ndedupcuts = 0;
+   benders->dedupcutspos = 0;
+
+   return SCIP_OKAY;
+}
+
+/** frees the aggregated optimality cuts of the blocks of subproblems */
+static
+SCIP_RETCODE freeAggrCuts(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int i;
+
+   assert(benders != NULL);
+
+   if( benders->aggrcuts == NULL )
+      return SCIP_OKAY;
+
+   for( i = benders->naggrcuts - 1; i >= 0; i-- )
+   {
+      SCIP_BENDERSAGGRCUT* aggrcut;
+
+      aggrcut = benders->aggrcuts[i];
+
+      if( aggrcut == NULL )
+         continue;
+
+      SCIPhashmapFree(&aggrcut->varpos);
+      SCIPfreeBlockMemoryArrayNull(set->scip, &aggrcut->vals, aggrcut->varssize);
+      SCIPfreeBlockMemoryArrayNull(set->scip, &aggrcut->vars, aggrcut->varssize);
+      SCIPfreeBlockMemory(set->scip, &benders->aggrcuts[i]);
+   }
+
+   BMSfreeBlockMemoryArray(SCIPblkmem(set->scip), &benders->aggrcuts, benders->naggrcuts);
+   benders->naggrcuts = 0;
+
+   return SCIP_OKAY;
+}
+
+/** computes the sorted variable indices and the normalized coefficients and left hand side of a cut
+ *
+ *  The arrays varinds and normvals must have room for nvars entries. If the cut has no nonzero coefficients, then
+ *  success is set to FALSE.
+ */
+static
+void normalizeCut(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables in the cut */
+   int*                  varinds,            /**< array to store the sorted variable indices */
+   SCIP_Real*            normvals,           /**< array to store the normalized coefficients */
+   SCIP_Real*            normlhs,            /**< pointer to store the normalized left hand side */
+   SCIP_Bool*            success             /**< pointer to store whether the cut could be normalized */
+   )
+{
+   SCIP_Real norm;
+   int i;
+
+   norm = 0.0;
+   for( i = 0; i < nvars; i++ )
+   {
+      varinds[i] = SCIPvarGetIndex(vars[i]);
+      normvals[i] = vals[i];
+      norm += SQR(vals[i]);
+   }
+   norm = sqrt(norm);
+
+   (*success) = SCIPsetIsPositive(set, norm);
+   if( !(*success) )
+      return;
+
+   for( i = 0; i < nvars; i++ )
+      normvals[i] /= norm;
+   (*normlhs) = lhs / norm;
+
+   SCIPsortIntReal(varinds, normvals, nvars);
+}
+
+/** computes the parallelism of two normalized cuts given by sorted variable indices */
+static
+SCIP_Real computeCutParallelism(
+   int*                  varinds1,           /**< the sorted variable indices of the first cut */
+   SCIP_Real*            vals1,              /**< the normalized coefficients of the first cut */
+   int                   nvars1,             /**< the number of variables in the first cut */
+   int*                  varinds2,           /**< the sorted variable indices of the second cut */
+   SCIP_Real*            vals2,              /**< the normalized coefficients of the second cut */
+   int                   nvars2              /**< the number of variables in the second cut */
+   )
+{
+   SCIP_Real prod;
+   int i;
+   int j;
+
+   prod = 0.0;
+   i = 0;
+   j = 0;
+   while( i < nvars1 && j < nvars2 )
+   {
+      if( varinds1[i] < varinds2[j] )
+         i++;
+      else if( varinds1[i] > varinds2[j] )
+         j++;
+      else
+      {
+         prod += vals1[i] * vals2[j];
+         i++;
+         j++;
+      }
+   }
+
+   return prod;
+}
+
 /** informs Benders' decomposition that the branch and bound process data is being freed */
 SCIP_RETCODE SCIPbendersExitsol(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition */
@@ -2496,6 +2687,10 @@ SCIP_RETCODE SCIPbendersExitsol(
       }
    }
 
+   /* the rows and constraints of the rotating cut memory must be released before the LP is freed */
+   SCIP_CALL( freeDedupCuts(benders, set) );
+   SCIP_CALL( freeAggrCuts(benders, set) );
+
    /* call solving process deinitialization method of Benders' decomposition */
    if( benders->bendersexitsol != NULL )
    {
@@ -3368,6 +3563,115 @@ SCIP_RETCODE solveBendersSubproblems(
    return retcode;
 }
 
+/** adds the aggregated optimality cuts of the blocks of subproblems to the master problem and resets the aggregation
+ *
+ *  An aggregated cut is the sum of the optimality cuts of its block, each of which is violated by the given solution.
+ *  As for single optimality cuts, near-duplicates of recently added cuts are replaced by the previous cut.
+ */
+static
+SCIP_RETCODE applyAggregatedCuts(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_BENDERSENFOTYPE  type                /**< the type of solution being enforced */
+   )
+{
+   SCIP_CONSHDLR* consbenders;
+   char cutname[SCIP_MAXSTRLEN];
+   int i;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+
+   if( benders->aggrcuts == NULL )
+      return SCIP_OKAY;
+
+   consbenders = SCIPfindConshdlr(set->scip, "benders");
+
+   for( i = 0; i < benders->naggrcuts; i++ )
+   {
+      SCIP_BENDERSAGGRCUT* aggrcut;
+      SCIP_ROW* duprow;
+      SCIP_ROW* row;
+      SCIP_CONS* cons;
+      SCIP_Bool infeasible;
+
+      aggrcut = benders->aggrcuts[i];
+
+      if( aggrcut == NULL || aggrcut->ncuts == 0 )
+         continue;
+
+      row = NULL;
+      cons = NULL;
+      duprow = NULL;
+
+      (void) SCIPsnprintf(cutname, SCIP_MAXSTRLEN, "aggrcut_%d_%d", i, benders->naggregatedcuts);
+
+      if( aggrcut->addcut && (type == SCIP_BENDERSENFOTYPE_LP || type == SCIP_BENDERSENFOTYPE_RELAX) )
+      {
+         SCIP_CALL( SCIPbendersFindDuplicateCut(benders, set, sol, aggrcut->vars, aggrcut->vals, aggrcut->lhs,
+               aggrcut->nvars, &duprow) );
+      }
+
+      if( duprow != NULL )
+      {
+         SCIP_CALL( SCIPaddRow(set->scip, duprow, FALSE, &infeasible) );
+         assert(!infeasible);
+      }
+      else
+      {
+         if( aggrcut->addcut )
+         {
+            SCIP_CALL( SCIPcreateEmptyRowConshdlr(set->scip, &row, consbenders, cutname, aggrcut->lhs,
+                  SCIPsetInfinity(set), FALSE, FALSE, TRUE) );
+            SCIP_CALL( SCIPaddVarsToRow(set->scip, row, aggrcut->nvars, aggrcut->vars, aggrcut->vals) );
+
+            if( type == SCIP_BENDERSENFOTYPE_LP || type == SCIP_BENDERSENFOTYPE_RELAX )
+            {
+               SCIP_CALL( SCIPaddRow(set->scip, row, FALSE, &infeasible) );
+               assert(!infeasible);
+            }
+            else
+            {
+               SCIP_CALL( SCIPaddPoolCut(set->scip, row) );
+            }
+         }
+         else
+         {
+            SCIP_CALL( SCIPcreateConsBasicLinear(set->scip, &cons, cutname, aggrcut->nvars, aggrcut->vars,
+                  aggrcut->vals, aggrcut->lhs, SCIPsetInfinity(set)) );
+            SCIP_CALL( SCIPsetConsDynamic(set->scip, cons, TRUE) );
+            SCIP_CALL( SCIPsetConsRemovable(set->scip, cons, TRUE) );
+            SCIP_CALL( SCIPaddCons(set->scip, cons) );
+         }
+
+         SCIP_CALL( SCIPbendersRecordCut(benders, set, aggrcut->vars, aggrcut->vals, aggrcut->lhs, aggrcut->nvars,
+               row, cons) );
+         SCIP_CALL( SCIPbendersStoreCut(benders, set, aggrcut->vars, aggrcut->vals, aggrcut->lhs,
+               SCIPsetInfinity(set), aggrcut->nvars) );
+
+         if( row != NULL )
+         {
+            SCIP_CALL( SCIPreleaseRow(set->scip, &row) );
+         }
+         else
+         {
+            SCIP_CALL( SCIPreleaseCons(set->scip, &cons) );
+         }
+      }
+
+      benders->naggregatedcuts++;
+
+      /* resetting the aggregation of the block */
+      SCIPhashmapRemoveAll(aggrcut->varpos);
+      aggrcut->nvars = 0;
+      aggrcut->ncuts = 0;
+      aggrcut->lhs = 0.0;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** Calls the Benders' decompsition cuts for the given solve loop. There are four cases:
  *  i) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX - only the LP Benders' cuts are called
  *  ii) solveloop == SCIP_BENDERSSOLVELOOP_CIP - only the CIP Benders' cuts are called
@@ -3542,6 +3846,9 @@ SCIP_RETCODE generateBendersCuts(
             }
          }
       }
+
+      /* the optimality cuts that were aggregated while looping over the subproblems are added now */
+      SCIP_CALL( applyAggregatedCuts(benders, set, sol, type) );
    }
 
    /* updating the overall result based upon the priorities */
@@ -6752,6 +7059,26 @@ int SCIPbendersGetNStoredCuts(
    return benders->nstoredcuts;
 }
 
+/** returns the number of generated cuts that were identified as near-duplicates of recently added cuts */
+int SCIPbendersGetNDuplicateCuts(
+   SCIP_BENDERS*         benders             /**< Benders' decomposition */
+   )
+{
+   assert(benders != NULL);
+
+   return benders->ndupcuts;
+}
+
+/** returns the number of aggregated optimality cuts that were added, see parameter benders/<name>/cutaggrsize */
+int SCIPbendersGetNAggregatedCuts(
+   SCIP_BENDERS*         benders             /**< Benders' decomposition */
+   )
+{
+   assert(benders != NULL);
+
+   return benders->naggregatedcuts;
+}
+
 /** returns the cuts that have been stored for transfer */
 SCIP_RETCODE SCIPbendersGetStoredCutData(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition */
@@ -6879,6 +7206,255 @@ SCIP_RETCODE SCIPbendersStoreCut(
    return SCIP_OKAY;
 }
 
+/** searches the rotating cut memory for a near-duplicate of the given cut of the form vals * vars >= lhs
+ *
+ *  A previously added cut is a duplicate if its parallelism to the given cut is at least the dedupmaxparall parameter,
+ *  it is at least as strong as the given cut and it is still violated by the given solution, i.e. it is not part of
+ *  the current LP. The supports of the cuts may differ, as long as the coefficients outside of the common support are
+ *  small enough for the cuts to be nearly parallel. For cuts that were added as linear constraints, the row of the
+ *  constraint is returned. If no duplicate is found, then duprow is set to NULL.
+ */
+SCIP_RETCODE SCIPbendersFindDuplicateCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_SOL*             sol,                /**< the solution that is separated by the cut, can be NULL */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_ROW**            duprow              /**< pointer to store the row of the duplicate cut, or NULL */
+   )
+{
+   SCIP_Real* normvals;
+   SCIP_Real normlhs;
+   SCIP_Bool success;
+   int* varinds;
+   int i;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+   assert(vars != NULL || nvars == 0);
+   assert(vals != NULL || nvars == 0);
+   assert(duprow != NULL);
+
+   (*duprow) = NULL;
+
+   if( !benders->dedupcutsenabled || benders->ndedupcuts == 0 || nvars == 0 || SCIPsetIsInfinity(set, -lhs) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &varinds, nvars) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &normvals, nvars) );
+
+   normalizeCut(set, vars, vals, lhs, nvars, varinds, normvals, &normlhs, &success);
+
+   if( success )
+   {
+      for( i = 0; i < benders->ndedupcuts; i++ )
+      {
+         SCIP_BENDERSDEDUPCUT* dedupcut;
+         SCIP_ROW* row;
+
+         dedupcut = benders->dedupcuts[i];
+
+         /* the previous cut must not be weaker than the new cut */
+         if( SCIPsetIsFeasGT(set, normlhs, dedupcut->lhs) )
+            continue;
+
+         if( computeCutParallelism(varinds, normvals, nvars, dedupcut->varinds, dedupcut->vals, dedupcut->nvars)
+            < benders->dedupmaxparall )
+            continue;
+
+         /* the previous cut is only reused if its row is available, outside of the LP and violated by the solution */
+         row = dedupcut->row;
+         if( row == NULL && dedupcut->cons != NULL && SCIPconsIsActive(dedupcut->cons) )
+            row = SCIPgetRowLinear(set->scip, dedupcut->cons);
+
+         if( row == NULL || SCIProwIsInLP(row) || !SCIPsetIsFeasNegative(set, SCIPgetRowSolFeasibility(set->scip, row, sol)) )
+            continue;
+
+         (*duprow) = row;
+         benders->ndupcuts++;
+
+         SCIPsetDebugMsg(set, "Benders' cut is a duplicate of the cut in position %d of the cut memory.\n", i);
+
+         break;
+      }
+   }
+
+   SCIPsetFreeBufferArray(set, &normvals);
+   SCIPsetFreeBufferArray(set, &varinds);
+
+   return SCIP_OKAY;
+}
+
+/** records an added cut of the form vals * vars >= lhs in the rotating cut memory for duplicate detection
+ *
+ *  The row or constraint that has been added to the master problem for this cut is captured. If the memory is full,
+ *  then the oldest cut is replaced.
+ */
+SCIP_RETCODE SCIPbendersRecordCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_ROW*             row,                /**< the row that was added for the cut, or NULL */
+   SCIP_CONS*            cons                /**< the constraint that was added for the cut, or NULL */
+   )
+{
+   SCIP_BENDERSDEDUPCUT* dedupcut;
+   SCIP_Bool success;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+   assert(vars != NULL || nvars == 0);
+   assert(vals != NULL || nvars == 0);
+   assert((row == NULL) != (cons == NULL));
+
+   if( !benders->dedupcutsenabled || nvars == 0 || SCIPsetIsInfinity(set, -lhs) )
+      return SCIP_OKAY;
+
+   if( benders->dedupcuts == NULL )
+   {
+      SCIP_ALLOC( BMSallocBlockMemoryArray(SCIPblkmem(set->scip), &benders->dedupcuts, benders->dedupmemsize) );
+      benders->dedupcutssize = benders->dedupmemsize;
+      benders->ndedupcuts = 0;
+      benders->dedupcutspos = 0;
+   }
+
+   SCIP_CALL( SCIPallocBlockMemory(set->scip, &dedupcut) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(set->scip, &dedupcut->varinds, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(set->scip, &dedupcut->vals, nvars) );
+   dedupcut->nvars = nvars;
+
+   normalizeCut(set, vars, vals, lhs, nvars, dedupcut->varinds, dedupcut->vals, &dedupcut->lhs, &success);
+
+   if( !success )
+   {
+      SCIPfreeBlockMemoryArray(set->scip, &dedupcut->vals, nvars);
+      SCIPfreeBlockMemoryArray(set->scip, &dedupcut->varinds, nvars);
+      SCIPfreeBlockMemory(set->scip, &dedupcut);
+
+      return SCIP_OKAY;
+   }
+
+   dedupcut->row = row;
+   dedupcut->cons = cons;
+
+   if( row != NULL )
+   {
+      SCIP_CALL( SCIPcaptureRow(set->scip, row) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPcaptureCons(set->scip, cons) );
+   }
+
+   /* replacing the oldest cut if the memory is full */
+   if( benders->ndedupcuts == benders->dedupcutssize )
+   {
+      SCIP_CALL( freeDedupCut(set, &benders->dedupcuts[benders->dedupcutspos]) );
+   }
+   else
+      benders->ndedupcuts++;
+
+   benders->dedupcuts[benders->dedupcutspos] = dedupcut;
+   benders->dedupcutspos = (benders->dedupcutspos + 1) % benders->dedupcutssize;
+
+   return SCIP_OKAY;
+}
+
+/** adds an optimality cut of the form vals * vars >= lhs of a subproblem to the aggregated cut of its block of
+ *  subproblems
+ *
+ *  The subproblems are partitioned into blocks of benders/<name>/cutaggrsize consecutive subproblems. The aggregated
+ *  cuts are added to the master problem after all subproblems have been solved for the current solution. If the cut
+ *  aggregation is disabled or the master problem is not being solved, then the cut is not aggregated and must be added
+ *  by the caller.
+ */
+SCIP_RETCODE SCIPbendersAggregateCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   int                   probnumber,         /**< the subproblem that generated the cut */
+   SCIP_Bool             addcut,             /**< should the aggregated cut be added as a row instead of a constraint? */
+   SCIP_Bool*            aggregated          /**< pointer to store whether the cut was aggregated */
+   )
+{
+   SCIP_BENDERSAGGRCUT* aggrcut;
+   int block;
+   int i;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+   assert(vars != NULL || nvars == 0);
+   assert(vals != NULL || nvars == 0);
+   assert(probnumber >= 0 && probnumber < benders->nsubproblems);
+   assert(aggregated != NULL);
+
+   (*aggregated) = FALSE;
+
+   if( benders->cutaggrsize <= 1 || SCIPsetGetStage(set) != SCIP_STAGE_SOLVING || SCIPsetIsInfinity(set, -lhs) )
+      return SCIP_OKAY;
+
+   if( benders->aggrcuts == NULL )
+   {
+      benders->naggrcuts = (benders->nsubproblems + benders->cutaggrsize - 1) / benders->cutaggrsize;
+      SCIP_ALLOC( BMSallocClearBlockMemoryArray(SCIPblkmem(set->scip), &benders->aggrcuts, benders->naggrcuts) );
+   }
+
+   block = probnumber / benders->cutaggrsize;
+   assert(block < benders->naggrcuts);
+
+   if( benders->aggrcuts[block] == NULL )
+   {
+      SCIP_CALL( SCIPallocClearBlockMemory(set->scip, &benders->aggrcuts[block]) );
+      SCIP_CALL( SCIPhashmapCreate(&benders->aggrcuts[block]->varpos, SCIPblkmem(set->scip), MAX(nvars, 16)) );
+   }
+   aggrcut = benders->aggrcuts[block];
+
+   /* the cut is added to the aggregation by summing up the coefficients of common variables */
+   if( aggrcut->nvars + nvars > aggrcut->varssize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, aggrcut->nvars + nvars);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(set->scip, &aggrcut->vars, aggrcut->varssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(set->scip, &aggrcut->vals, aggrcut->varssize, newsize) );
+      aggrcut->varssize = newsize;
+   }
+
+   for( i = 0; i < nvars; i++ )
+   {
+      int pos;
+
+      pos = SCIPhashmapGetImageInt(aggrcut->varpos, (void*)vars[i]);
+
+      if( pos == INT_MAX )
+      {
+         pos = aggrcut->nvars;
+         aggrcut->vars[pos] = vars[i];
+         aggrcut->vals[pos] = 0.0;
+         aggrcut->nvars++;
+         SCIP_CALL( SCIPhashmapInsertInt(aggrcut->varpos, (void*)vars[i], pos) );
+      }
+
+      aggrcut->vals[pos] += vals[i];
+   }
+
+   aggrcut->lhs += lhs;
+   aggrcut->addcut = addcut;
+   aggrcut->ncuts++;
+
+   (*aggregated) = TRUE;
+
+   return SCIP_OKAY;
+}
+
 /** sets the sorted flags in the Benders' decomposition */
 void SCIPbendersSetBenderscutsSorted(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition structure */
@@ -37,7 +37,9 @@
 #include "scip/def.h"
 #include "scip/type_benders.h"
 #include "scip/type_benderscut.h"
+#include "scip/type_cons.h"
 #include "scip/type_dcmp.h"
+#include "scip/type_lp.h"
 #include "scip/type_message.h"
 #include "scip/type_misc.h"
 #include "scip/type_result.h"
@@ -413,6 +415,45 @@ SCIP_Bool SCIPbendersGetMastervarsCont(
    int                   probnumber          /**< the subproblem number */
    );
 
+/** searches the rotating cut memory for a near-duplicate of the given cut of the form vals * vars >= lhs */
+SCIP_RETCODE SCIPbendersFindDuplicateCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_SOL*             sol,                /**< the solution that is separated by the cut, can be NULL */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_ROW**            duprow              /**< pointer to store the row of the duplicate cut, or NULL */
+   );
+
+/** records an added cut of the form vals * vars >= lhs in the rotating cut memory for duplicate detection */
+SCIP_RETCODE SCIPbendersRecordCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_ROW*             row,                /**< the row that was added for the cut, or NULL */
+   SCIP_CONS*            cons                /**< the constraint that was added for the cut, or NULL */
+   );
+
+/** adds an optimality cut of the form vals * vars >= lhs of a subproblem to the aggregated cut of its block of
+ *  subproblems
+ */
+SCIP_RETCODE SCIPbendersAggregateCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   int                   probnumber,         /**< the subproblem that generated the cut */
+   SCIP_Bool             addcut,             /**< should the aggregated cut be added as a row instead of a constraint? */
+   SCIP_Bool*            aggregated          /**< pointer to store whether the cut was aggregated */
+   );
+
 /** adds the data for the generated cuts to the Benders' cut storage */
 SCIP_RETCODE SCIPbendersStoreCut(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition cut */
@@ -858,6 +858,7 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
    SCIP_CONSHDLR* consbenders;
    SCIP_CONS* cons;
    SCIP_ROW* row;
+   SCIP_ROW* duprow;
    SCIP_VAR** vars;
    SCIP_Real* vals;
    SCIP_Real lhs;
@@ -869,6 +870,7 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
    SCIP_Bool optimal;
    SCIP_Bool success;
    SCIP_Bool mirsuccess;
+   SCIP_Bool aggregated;
 
    SCIP_Real checkobj;
    SCIP_Real verifyobj;
@@ -885,10 +887,12 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
 
    row = NULL;
    cons = NULL;
+   duprow = NULL;
 
    calcmir = SCIPbenderscutGetData(benderscut)->calcmir && SCIPgetStage(masterprob) >= SCIP_STAGE_INITSOLVE && SCIPgetSubscipDepth(masterprob) == 0;
    success = FALSE;
    mirsuccess = FALSE;
+   aggregated = FALSE;
 
    /* retrieving the Benders' decomposition constraint handler */
    consbenders = SCIPfindConshdlr(masterprob, "benders");
@@ -1023,12 +1027,30 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
             SCIP_CALL( addAuxiliaryVariableToCut(masterprob, benders, vars, vals, &nvars, probnumber) );
          }
 
+         /* if the optimality cuts of several subproblems are aggregated, then the cut is added to the aggregated cut of
+          * its block of subproblems. The aggregated cut is added once all subproblems have been processed.
+          */
+         if( !feasibilitycut && SCIPgetStage(masterprob) == SCIP_STAGE_SOLVING )
+         {
+            SCIP_CALL( SCIPaggregateBendersCut(masterprob, benders, vars, vals, lhs, nvars, probnumber, addcut,
+                  &aggregated) );
+         }
+
+         /* if a near-duplicate of this cut has been added recently and has since left the LP, then its row is added
+          * again instead of a new, nearly parallel cut
+          */
+         if( !aggregated && SCIPgetStage(masterprob) == SCIP_STAGE_SOLVING
+            && (type == SCIP_BENDERSENFOTYPE_LP || type == SCIP_BENDERSENFOTYPE_RELAX) )
+         {
+            SCIP_CALL( SCIPfindBendersDuplicateCut(masterprob, benders, sol, vars, vals, lhs, nvars, &duprow) );
+         }
+
          /* performing the MIR procedure. If the procedure is successful, then the vars and vals arrays are no longer
           * needed for creating the optimality cut. These are superseeded with the cutcoefs and cutinds arrays. In the
           * case that the MIR procedure is successful, the row/constraint that has been created previously is destroyed
           * and the MIR cut is added in its place
           */
-         if( calcmir )
+         if( calcmir && duprow == NULL && !aggregated )
          {
             SCIP_Real* cutcoefs;
             int* cutinds;
@@ -1078,6 +1100,18 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
                      SCIP_CALL( SCIPaddCoefLinear(masterprob, cons, mastervars[cutinds[i]], cutcoefs[i]) );
                   }
                }
+
+               /* the MIR cut cutcoefs * x <= cutrhs is recorded and stored in the form vals * vars >= lhs, so that the
+                * stored cut is the one that has been added to the master problem
+                */
+               for( i = 0; i < cutnnz; i++ )
+               {
+                  vars[i] = mastervars[cutinds[i]];
+                  vals[i] = -cutcoefs[i];
+               }
+               nvars = cutnnz;
+               lhs = -cutrhs;
+               rhs = SCIPinfinity(masterprob);
             }
 
             /* freeing the memory required to compute the MIR cut */
@@ -1086,7 +1120,25 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
          }
 
          /* adding the constraint to the master problem */
-         if( addcut )
+         if( aggregated )
+         {
+            SCIPdebugMsg(masterprob, "Aggregated the Benders' optimality cut for problem %d.\n", probnumber);
+
+            (*result) = addcut ? SCIP_SEPARATED : SCIP_CONSADDED;
+         }
+         else if( duprow != NULL )
+         {
+            SCIP_Bool infeasible;
+
+            SCIPdebugMsg(masterprob, "Reusing row <%s> instead of the Benders' cut for problem %d.\n",
+               SCIProwGetName(duprow), probnumber);
+
+            SCIP_CALL( SCIPaddRow(masterprob, duprow, FALSE, &infeasible) );
+            assert(!infeasible);
+
+            (*result) = SCIP_SEPARATED;
+         }
+         else if( addcut )
          {
             SCIP_Bool infeasible;
 
@@ -1130,8 +1182,17 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
             (*result) = SCIP_CONSADDED;
          }
 
-         /* storing the data that is used to create the cut */
-         SCIP_CALL( SCIPstoreBendersCut(masterprob, benders, vars, vals, lhs, rhs, nvars) );
+         if( duprow == NULL && !aggregated )
+         {
+            /* recording the cut for the detection of near-duplicates in later rounds */
+            if( SCIPgetStage(masterprob) == SCIP_STAGE_SOLVING )
+            {
+               SCIP_CALL( SCIPrecordBendersCut(masterprob, benders, vars, vals, lhs, nvars, row, cons) );
+            }
+
+            /* storing the data that is used to create the cut */
+            SCIP_CALL( SCIPstoreBendersCut(masterprob, benders, vars, vals, lhs, rhs, nvars) );
+         }
       }
       else
       {
@@ -42,6 +42,8 @@
 #include "blockmemshell/memory.h"
 #include "scip/set.h"
 #include "scip/stat.h"
+#include "scip/struct_stat.h"
+#include "scip/trace.h"
 #include "scip/clock.h"
 #include "scip/paramset.h"
 #include "scip/event.h"
@@ -1587,7 +1589,9 @@ SCIP_RETCODE SCIPbranchruleExecLPSol(
          SCIPclockStart(branchrule->branchclock, set);
 
          /* call external method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( branchrule->branchexeclp(set->scip, branchrule, allowaddcons, result) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_BRANCH, branchrule->name);
 
          /* stop timing */
          SCIPclockStop(branchrule->branchclock, set);
@@ -1695,7 +1699,9 @@ SCIP_RETCODE SCIPbranchruleExecExternSol(
          SCIPclockStart(branchrule->branchclock, set);
 
          /* call external method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( branchrule->branchexecext(set->scip, branchrule, allowaddcons, result) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_BRANCH, branchrule->name);
 
          /* stop timing */
          SCIPclockStop(branchrule->branchclock, set);
@@ -1797,7 +1803,9 @@ SCIP_RETCODE SCIPbranchruleExecPseudoSol(
          SCIPclockStart(branchrule->branchclock, set);
 
          /* call external method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( branchrule->branchexecps(set->scip, branchrule, allowaddcons, result) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_BRANCH, branchrule->name);
 
          /* stop timing */
          SCIPclockStop(branchrule->branchclock, set);
@@ -226,6 +226,38 @@ void SCIPconflictEnableOrDisableClocks(
    SCIPclockEnableOrDisable(conflict->sbanalyzetime, enable);
 }
 
+/** returns whether the current conflict should not be analyzed by a conflict analysis type, because the analysis type
+ *  was unproductive so far
+ *
+ *  An analysis type is unproductive if its share of successful calls is below conflict/minsuccessrate after at least
+ *  conflict/minsuccesscalls calls. Unproductive analysis types are still applied to every conflict/skipfreq-th
+ *  conflict, such that they are resumed if they become successful again.
+ */
+SCIP_Bool SCIPconflictSkipUnproductive(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Longint          ncalls,             /**< number of calls of the analysis type */
+   SCIP_Longint          nsuccess,           /**< number of successful calls of the analysis type */
+   SCIP_Longint*         nskipped            /**< pointer to number of skipped calls of the analysis type */
+   )
+{
+   assert(set != NULL);
+   assert(nskipped != NULL);
+
+   if( set->conf_minsuccessrate <= 0.0 || ncalls < set->conf_minsuccesscalls )
+      return FALSE;
+
+   if( nsuccess >= set->conf_minsuccessrate * ncalls )
+      return FALSE;
+
+   /* apply the analysis type to every conf_skipfreq-th conflict, counted over applied and skipped calls */
+   if( (ncalls + *nskipped) % set->conf_skipfreq == 0 )
+      return FALSE;
+
+   ++(*nskipped);
+
+   return TRUE;
+}
+
 /** creates conflict analysis data for propagation conflicts */
 SCIP_RETCODE SCIPconflictCreate(
    SCIP_CONFLICT**       conflict,           /**< pointer to conflict analysis data */
@@ -302,6 +334,10 @@ SCIP_RETCODE SCIPconflictCreate(
    (*conflict)->npseudoconfliterals = 0;
    (*conflict)->npseudoreconvconss = 0;
    (*conflict)->npseudoreconvliterals = 0;
+   (*conflict)->npropskipped = 0;
+   (*conflict)->ninflpskipped = 0;
+   (*conflict)->nboundlpskipped = 0;
+   (*conflict)->npseudoskipped = 0;
    (*conflict)->ndualproofsinfglobal = 0;
    (*conflict)->ndualproofsinflocal = 0;
    (*conflict)->ndualproofsinfsuccess = 0;
@@ -425,6 +461,16 @@ SCIP_Longint SCIPconflictGetNPropSuccess(
    return conflict->npropsuccess;
 }
 
+/** gets number of calls to propagation conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNPropSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+
+   return conflict->npropskipped;
+}
+
 /** gets number of conflict constraints detected in propagation conflict analysis */
 SCIP_Longint SCIPconflictGetNPropConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -495,6 +541,16 @@ SCIP_Longint SCIPconflictGetNInfeasibleLPSuccess(
    return conflict->ninflpsuccess;
 }
 
+/** gets number of calls to infeasible LP conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNInfeasibleLPSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+
+   return conflict->ninflpskipped;
+}
+
 /** gets number of conflict constraints detected in infeasible LP conflict analysis */
 SCIP_Longint SCIPconflictGetNInfeasibleLPConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -575,6 +631,16 @@ SCIP_Longint SCIPconflictGetNBoundexceedingLPSuccess(
    return conflict->nboundlpsuccess;
 }
 
+/** gets number of calls to bound exceeding LP conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNBoundexceedingLPSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+
+   return conflict->nboundlpskipped;
+}
+
 /** gets number of conflict constraints detected in bound exceeding LP conflict analysis */
 SCIP_Longint SCIPconflictGetNBoundexceedingLPConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -1608,6 +1674,10 @@ SCIP_RETCODE SCIPconflictAnalyzePseudo(
    if( set->nconflicthdlrs == 0 )
       return SCIP_OKAY;
 
+   /* check, if pseudo solution conflict analysis was productive so far */
+   if( SCIPconflictSkipUnproductive(set, conflict->npseudocalls, conflict->npseudosuccess, &conflict->npseudoskipped) )
+      return SCIP_OKAY;
+
    SCIPsetDebugMsg(set, "analyzing pseudo solution (obj: %g) that exceeds objective limit (%g)\n",
       SCIPlpGetPseudoObjval(lp, set, transprob), lp->cutoffbound);
 
@@ -1741,6 +1811,16 @@ SCIP_Longint SCIPconflictGetNPseudoSuccess(
    return conflict->npseudosuccess;
 }
 
+/** gets number of calls to pseudo solution conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNPseudoSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+
+   return conflict->npseudoskipped;
+}
+
 /** gets number of conflict constraints detected in pseudo solution conflict analysis */
 SCIP_Longint SCIPconflictGetNPseudoConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -2536,6 +2616,18 @@ SCIP_RETCODE SCIPconflictAnalyzeLP(
    if( !SCIPlpiWasSolved(SCIPlpGetLPI(lp)) )
       return SCIP_OKAY;
 
+   /* check, if the LP conflict analysis type was productive so far */
+   if( SCIPlpiIsPrimalInfeasible(SCIPlpGetLPI(lp)) )
+   {
+      if( SCIPconflictSkipUnproductive(set, conflict->ninflpcalls, conflict->ninflpsuccess, &conflict->ninflpskipped) )
+         return SCIP_OKAY;
+   }
+   else
+   {
+      if( SCIPconflictSkipUnproductive(set, conflict->nboundlpcalls, conflict->nboundlpsuccess, &conflict->nboundlpskipped) )
+         return SCIP_OKAY;
+   }
+
    /* LP conflict analysis is only valid, if all variables are known */
    assert( SCIPprobAllColsInLP(transprob, set, lp) );
    assert( SCIPlpGetSolstat(lp) == SCIP_LPSOLSTAT_INFEASIBLE || SCIPlpGetSolstat(lp) == SCIP_LPSOLSTAT_OBJLIMIT
@@ -75,6 +75,16 @@ extern "C" {
  * Conflict Analysis
  */
 
+/** returns whether the current conflict should not be analyzed by a conflict analysis type, because the analysis type
+ *  was unproductive so far
+ */
+SCIP_Bool SCIPconflictSkipUnproductive(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Longint          ncalls,             /**< number of calls of the analysis type */
+   SCIP_Longint          nsuccess,           /**< number of successful calls of the analysis type */
+   SCIP_Longint*         nskipped            /**< pointer to number of skipped calls of the analysis type */
+   );
+
 /** creates conflict analysis data for propagation conflicts */
 SCIP_RETCODE SCIPconflictCreate(
    SCIP_CONFLICT**       conflict,           /**< pointer to conflict analysis data */
@@ -187,6 +197,11 @@ SCIP_Longint SCIPconflictGetNPropSuccess(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
    );
 
+/** gets number of calls to propagation conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNPropSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   );
+
 /** gets number of conflict constraints detected in propagation conflict analysis */
 SCIP_Longint SCIPconflictGetNPropConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -249,6 +264,11 @@ SCIP_Longint SCIPconflictGetNInfeasibleLPSuccess(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
    );
 
+/** gets number of calls to infeasible LP conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNInfeasibleLPSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   );
+
 /** gets number of conflict constraints detected in infeasible LP conflict analysis */
 SCIP_Longint SCIPconflictGetNInfeasibleLPConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -289,6 +309,11 @@ SCIP_Longint SCIPconflictGetNBoundexceedingLPSuccess(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
    );
 
+/** gets number of calls to bound exceeding LP conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNBoundexceedingLPSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   );
+
 /** gets number of conflict constraints detected in bound exceeding LP conflict analysis */
 SCIP_Longint SCIPconflictGetNBoundexceedingLPConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -467,6 +492,11 @@ SCIP_Longint SCIPconflictGetNPseudoSuccess(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
    );
 
+/** gets number of calls to pseudo solution conflict analysis that were skipped, because it was unproductive so far */
+SCIP_Longint SCIPconflictGetNPseudoSkipped(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   );
+
 /** gets number of conflict constraints detected in pseudo solution conflict analysis */
 SCIP_Longint SCIPconflictGetNPseudoConflictConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
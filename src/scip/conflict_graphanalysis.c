@@ -5478,6 +5478,10 @@ SCIP_RETCODE SCIPconflictAnalyze(
       + SCIPpqueueNElems(conflict->forcedbdchgqueue) >= 2*conflictCalcMaxsize(set, prob) )
       return SCIP_OKAY;
 
+   /* check, if propagation conflict analysis was productive so far */
+   if( SCIPconflictSkipUnproductive(set, conflict->npropcalls, conflict->npropsuccess, &conflict->npropskipped) )
+      return SCIP_OKAY;
+
    SCIPsetDebugMsg(set, "analyzing conflict after infeasible propagation in depth %d\n", SCIPtreeGetCurrentDepth(tree));
 
    /* start timing */
@@ -36,6 +36,8 @@
 #include "scip/def.h"
 #include "scip/set.h"
 #include "scip/stat.h"
+#include "scip/struct_stat.h"
+#include "scip/trace.h"
 #include "scip/clock.h"
 #include "scip/var.h"
 #include "scip/prob.h"
@@ -2230,6 +2232,7 @@ SCIP_RETCODE doConshdlrCreate(
    (*conshdlr)->delayupdatecount = 0;
    (*conshdlr)->ageresetavg = AGERESETAVG_INIT;
    (*conshdlr)->needscons = needscons;
+   (*conshdlr)->independentcheck = FALSE;
    (*conshdlr)->sepalpwasdelayed = FALSE;
    (*conshdlr)->sepasolwasdelayed = FALSE;
    (*conshdlr)->propwasdelayed = FALSE;
@@ -3288,7 +3291,9 @@ SCIP_RETCODE SCIPconshdlrEnforceRelaxSol(
       SCIPclockStart(conshdlr->enforelaxtime, set);
 
       /* call external method */
+      SCIPtraceBegin(stat->trace, set);
       SCIP_CALL( conshdlr->consenforelax(set->scip, relaxsol, conshdlr, conss, nconss, nusefulconss, solinfeasible, result) );
+      SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_CONSENFO, conshdlr->name);
       SCIPdebugMessage(" -> enforcing returned result <%d>\n", *result);
 
       /* stop timing */
@@ -3468,7 +3473,9 @@ SCIP_RETCODE SCIPconshdlrEnforceLPSol(
          SCIPclockStart(conshdlr->enfolptime, set);
 
          /* call external method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( conshdlr->consenfolp(set->scip, conshdlr, conss, nconss, nusefulconss, solinfeasible, result) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_CONSENFO, conshdlr->name);
          SCIPsetDebugMsg(set, " -> enforcing returned result <%d>\n", *result);
 
          /* stop timing */
@@ -3677,7 +3684,9 @@ SCIP_RETCODE SCIPconshdlrEnforcePseudoSol(
          SCIPclockStart(conshdlr->enfopstime, set);
 
          /* call external method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( conshdlr->consenfops(set->scip, conshdlr, conss, nconss, nusefulconss, solinfeasible, objinfeasible, result) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_CONSENFO, conshdlr->name);
          SCIPsetDebugMsg(set, " -> enforcing returned result <%d>\n", *result);
 
          /* stop timing */
@@ -5289,6 +5298,36 @@ void SCIPconshdlrSetPresolTiming(
    conshdlr->presoltiming = presoltiming;
 }
 
+/** sets whether the feasibility check of the constraint handler is independent of the order in which the constraint
+ *  handlers are checked
+ *
+ *  The check of such a constraint handler must neither rely on other constraint handlers being checked before, e.g.,
+ *  on the integrality of the solution, nor have side effects apart from updating the violation of the solution and the
+ *  ages of the constraints. The check of a solution can then start with this constraint handler if it rejected the
+ *  previous solution.
+ */
+void SCIPconshdlrSetIndependentCheck(
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_Bool             independentcheck    /**< is the check independent of the check order? */
+   )
+{
+   assert(conshdlr != NULL);
+
+   conshdlr->independentcheck = independentcheck;
+}
+
+/** returns whether the feasibility check of the constraint handler is independent of the order in which the constraint
+ *  handlers are checked
+ */
+SCIP_Bool SCIPconshdlrHasIndependentCheck(
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   )
+{
+   assert(conshdlr != NULL);
+
+   return conshdlr->independentcheck;
+}
+
 /** returns whether conshdlr supports permutation symmetry detection */
 SCIP_Bool SCIPconshdlrSupportsPermsymDetection(
    SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
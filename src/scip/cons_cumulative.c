@@ -121,6 +121,8 @@
 
 /* conflict analysis */
 #define DEFAULT_USEBDWIDENING           TRUE /**< should bound widening be used during conflict analysis? */
+#define DEFAULT_STOREEXPLANATIONS       TRUE /**< should the jobs explaining energy-based bound changes be stored during propagation? */
+#define MAXEXPLANATIONFACTOR              64 /**< maximal number of stored explanation jobs as a multiple of the number of jobs */
 
 /**@} */
 
@@ -138,6 +140,22 @@
  * Data structures
  */
 
+/** stored explanation of the energy-based bound changes with a certain time window; it consists of all jobs which may
+ *  run within the time window at the node where it was stored
+ *
+ *  Along a path of the search tree, the set of jobs which must run within a time window only grows; hence, the jobs of
+ *  an explanation which was stored at a node of the current path are a superset of the jobs which are needed to explain
+ *  any bound change with that time window on the current path.
+ */
+struct Explanation
+{
+   SCIP_Longint          nodenumber;         /**< number of the node where the explanation was stored */
+   int                   depth;              /**< depth of the node where the explanation was stored */
+   int                   start;              /**< position of the first job of the explanation in the job array */
+   int                   njobs;              /**< number of jobs of the explanation */
+};
+typedef struct Explanation EXPLANATION;
+
 /** constraint data for cumulative constraints */
 struct SCIP_ConsData
 {
@@ -166,6 +184,14 @@ struct SCIP_ConsData
    int                   bcoverrowssize;     /**< size of array of big cover cuts */
    int                   capacity;           /**< available cumulative capacity */
 
+   SCIP_HASHMAP*         explanationmap;     /**< maps time windows of energy-based bound changes to stored explanations, or NULL */
+   EXPLANATION*          explanations;       /**< stored explanations of energy-based bound changes */
+   int*                  explanationjobs;    /**< array containing the jobs of the stored explanations */
+   int                   nexplanations;      /**< number of stored explanations */
+   int                   explanationssize;   /**< size of explanations array */
+   int                   nexplanationjobs;   /**< number of entries in the explanationjobs array */
+   int                   explanationjobssize;/**< size of explanationjobs array */
+
    int                   hmin;               /**< left bound of time axis to be considered (including hmin) */
    int                   hmax;               /**< right bound of time axis to be considered  (not including hmax) */
 
@@ -209,6 +235,7 @@ struct SCIP_ConshdlrData
    SCIP_Bool             detectdisjunctive;  /**< search for conflict set via maximal cliques to detect disjunctive constraints */
    SCIP_Bool             detectvarbounds;    /**< search for conflict set via maximal cliques to detect variable bound constraints */
    SCIP_Bool             usebdwidening;      /**< should bound widening be used during conflict analysis? */
+   SCIP_Bool             storeexplanations;  /**< should the jobs explaining energy-based bound changes be stored during propagation? */
    SCIP_Bool             presolpairwise;     /**< should pairwise constraint comparison be performed in presolving? */
    SCIP_Bool             detectedredundant;  /**< was detection of redundant constraints already performed? */
 
@@ -2024,6 +2051,14 @@ SCIP_RETCODE consdataCreate(
    (*consdata)->disjfactor2 = -1.0;
    (*consdata)->estimatedstrength = -1.0;
 
+   (*consdata)->explanationmap = NULL;
+   (*consdata)->explanations = NULL;
+   (*consdata)->explanationjobs = NULL;
+   (*consdata)->nexplanations = 0;
+   (*consdata)->explanationssize = 0;
+   (*consdata)->nexplanationjobs = 0;
+   (*consdata)->explanationjobssize = 0;
+
    SCIPstatistic( (*consdata)->maxpeak = -1 );
 
    return SCIP_OKAY;
@@ -2080,6 +2115,27 @@ SCIP_RETCODE consdataFreeRows(
    return SCIP_OKAY;
 }
 
+/** frees the stored explanations of energy-based bound changes */
+static
+void consdataFreeExplanations(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata            /**< cumulative constraint data */
+   )
+{
+   assert(consdata != NULL);
+
+   if( consdata->explanationmap != NULL )
+      SCIPhashmapFree(&consdata->explanationmap);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->explanationjobs, consdata->explanationjobssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->explanations, consdata->explanationssize);
+
+   consdata->nexplanations = 0;
+   consdata->explanationssize = 0;
+   consdata->nexplanationjobs = 0;
+   consdata->explanationjobssize = 0;
+}
+
 /** frees a cumulative constraint data */
 static
 SCIP_RETCODE consdataFree(
@@ -2123,6 +2179,8 @@ SCIP_RETCODE consdataFree(
       SCIPfreeBlockMemoryArray(scip, &(*consdata)->vars, varssize);
    }
 
+   consdataFreeExplanations(scip, *consdata);
+
    /* free memory */
    SCIPfreeBlockMemory(scip, consdata);
 
@@ -2222,6 +2280,9 @@ SCIP_RETCODE consdataDeletePos(
    consdata->validsignature = FALSE;
    consdata->normalized = FALSE;
 
+   /* the stored explanations refer to positions in the arrays */
+   consdataFreeExplanations(scip, consdata);
+
    return SCIP_OKAY;
 }
 
@@ -2840,6 +2901,196 @@ SCIP_RETCODE resolvePropagationEdgeFinding(
 }
 #endif
 
+/** returns whether the node with the given number and depth lies on the path from the root to the current node */
+static
+SCIP_Bool isNodeOnPath(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Longint          nodenumber,         /**< number of the node */
+   int                   depth               /**< depth of the node */
+   )
+{
+   SCIP_NODE* node;
+
+   node = SCIPgetCurrentNode(scip);
+
+   while( node != NULL && SCIPnodeGetDepth(node) > depth )
+      node = SCIPnodeGetParent(node);
+
+   return (node != NULL && SCIPnodeGetDepth(node) == depth && SCIPnodeGetNumber(node) == nodenumber);
+}
+
+/** returns the jobs of the explanation which was stored for the given time window at a node of the current path, or
+ *  NULL if no such explanation exists
+ */
+static
+int* consdataGetExplanation(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< cumulative constraint data */
+   int                   begin,              /**< begin of the time window */
+   int                   end,                /**< end of the time window */
+   int*                  njobs               /**< pointer to store the number of jobs of the explanation */
+   )
+{
+   EXPLANATION* explanation;
+   void* key;
+
+   assert(consdata != NULL);
+   assert(njobs != NULL);
+
+   *njobs = 0;
+
+   if( consdata->explanationmap == NULL )
+      return NULL;
+
+   key = (void*)(size_t)(((unsigned int)begin << 15) + (unsigned int)end + 1); /*lint !e571*/
+
+   if( !SCIPhashmapExists(consdata->explanationmap, key) )
+      return NULL;
+
+   explanation = &consdata->explanations[SCIPhashmapGetImageInt(consdata->explanationmap, key)];
+
+   if( !isNodeOnPath(scip, explanation->nodenumber, explanation->depth) )
+      return NULL;
+
+   *njobs = explanation->njobs;
+
+   return &consdata->explanationjobs[explanation->start];
+}
+
+/** stores the jobs which may run within the time window of an energy-based bound change of a cumulative constraint,
+ *  unless an explanation which contains the inference job was already stored at a node of the current path
+ */
+static
+SCIP_RETCODE storeExplanation(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint which is propagated */
+   SCIP_VAR*             infervar,           /**< start time variable whose bound is changed */
+   int                   inferpos,           /**< position of the start time variable in the propagated arrays */
+   INFERINFO             inferinfo           /**< inference information of the bound change */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSDATA* consdata;
+   SCIP_NODE* node;
+   EXPLANATION* explanation;
+   void* key;
+   int* jobs;
+   int njobs;
+   int begin;
+   int end;
+   int pos;
+   int v;
+
+   assert(inferInfoGetProprule(inferinfo) == PROPRULE_2_EDGEFINDING || inferInfoGetProprule(inferinfo) == PROPRULE_3_TTEF);
+
+   /* the cumulative condition may be propagated for a constraint of another constraint handler */
+   if( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(cons)), CONSHDLR_NAME) != 0 )
+      return SCIP_OKAY;
+
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert(conshdlrdata != NULL);
+
+   if( !conshdlrdata->storeexplanations || SCIPgetStage(scip) != SCIP_STAGE_SOLVING
+      || !SCIPisConflictAnalysisApplicable(scip) )
+      return SCIP_OKAY;
+
+   /* probing nodes have no unique number */
+   node = SCIPgetCurrentNode(scip);
+   if( node == NULL || SCIPnodeGetNumber(node) <= 0 )
+      return SCIP_OKAY;
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+
+   /* the explanation stores positions in the arrays of the constraint */
+   if( inferpos < 0 || inferpos >= consdata->nvars || consdata->vars[inferpos] != infervar )
+      return SCIP_OKAY;
+
+   begin = inferInfoGetData1(inferinfo);
+   end = inferInfoGetData2(inferinfo);
+
+   /* check if an explanation with the inference job is already available */
+   jobs = consdataGetExplanation(scip, consdata, begin, end, &njobs);
+
+   for( v = 0; v < njobs; ++v )
+   {
+      if( jobs[v] == inferpos )
+         return SCIP_OKAY;
+   }
+
+   if( consdata->explanationmap == NULL )
+   {
+      SCIP_CALL( SCIPhashmapCreate(&consdata->explanationmap, SCIPblkmem(scip), consdata->nvars) );
+   }
+
+   /* forget all explanations if they use too much memory; they are collected again in conflict analysis */
+   if( consdata->nexplanationjobs + consdata->nvars > MAXEXPLANATIONFACTOR * consdata->nvars )
+   {
+      SCIP_CALL( SCIPhashmapRemoveAll(consdata->explanationmap) );
+      consdata->nexplanations = 0;
+      consdata->nexplanationjobs = 0;
+   }
+
+   key = (void*)(size_t)(((unsigned int)begin << 15) + (unsigned int)end + 1); /*lint !e571*/
+
+   /* replace an explanation of the same time window since it is not valid on the current path */
+   if( SCIPhashmapExists(consdata->explanationmap, key) )
+      pos = SCIPhashmapGetImageInt(consdata->explanationmap, key);
+   else
+   {
+      if( consdata->nexplanations == consdata->explanationssize )
+      {
+         int newsize;
+
+         newsize = SCIPcalcMemGrowSize(scip, consdata->nexplanations + 1);
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->explanations, consdata->explanationssize, newsize) );
+         consdata->explanationssize = newsize;
+      }
+
+      pos = consdata->nexplanations;
+      ++consdata->nexplanations;
+
+      SCIP_CALL( SCIPhashmapInsertInt(consdata->explanationmap, key, pos) );
+   }
+
+   if( consdata->nexplanationjobs + consdata->nvars > consdata->explanationjobssize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, consdata->nexplanationjobs + consdata->nvars);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->explanationjobs, consdata->explanationjobssize, newsize) );
+      consdata->explanationjobssize = newsize;
+   }
+
+   explanation = &consdata->explanations[pos];
+   explanation->nodenumber = SCIPnodeGetNumber(node);
+   explanation->depth = SCIPnodeGetDepth(node);
+   explanation->start = consdata->nexplanationjobs;
+   explanation->njobs = 0;
+
+   /* collect all jobs which may run within the time window and the inference job */
+   jobs = &consdata->explanationjobs[explanation->start];
+
+   for( v = 0; v < consdata->nvars; ++v )
+   {
+      int est;
+      int lst;
+
+      est = SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(consdata->vars[v]));
+      lst = SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(consdata->vars[v]));
+
+      if( v == inferpos || (est < end && lst + consdata->durations[v] > begin) )
+      {
+         jobs[explanation->njobs] = v;
+         ++explanation->njobs;
+      }
+   }
+
+   consdata->nexplanationjobs += explanation->njobs;
+
+   return SCIP_OKAY;
+}
+
 /** compute the minimum overlaps w.r.t. the duration of the job and the time window [begin,end) */
 static
 int computeOverlap(
@@ -2886,6 +3137,8 @@ SCIP_RETCODE analyzeEnergyRequirement(
    int*                  durations,          /**< array of durations */
    int*                  demands,            /**< array of demands */
    int                   capacity,           /**< capacity of the cumulative condition */
+   int*                  jobs,               /**< positions of the jobs which may contribute to the explanation, or NULL for all jobs */
+   int                   njobs,              /**< number of jobs which may contribute to the explanation */
    int                   begin,              /**< begin of the time window */
    int                   end,                /**< end of the time window */
    SCIP_VAR*             infervar,           /**< variable which was propagate, or NULL */
@@ -2901,11 +3154,27 @@ SCIP_RETCODE analyzeEnergyRequirement(
    int* idxs;
 
    SCIP_Longint requiredenergy;
+   int ncands;
+   int c;
    int v;
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &locenergies, nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &overlaps, nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &idxs, nvars) );
+   assert(jobs != NULL || njobs == 0);
+
+   /* the explanation can only be restricted to the given jobs if they contain the inference variable */
+   if( jobs != NULL && infervar != NULL )
+   {
+      for( c = 0; c < njobs && vars[jobs[c]] != infervar; ++c )
+         ;
+
+      if( c == njobs )
+         jobs = NULL;
+   }
+
+   ncands = (jobs != NULL ? njobs : nvars);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &locenergies, ncands) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &overlaps, ncands) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &idxs, ncands) );
 
    /* energy which needs be explained */
    requiredenergy = ((SCIP_Longint) end - begin) * capacity;
@@ -2915,7 +3184,7 @@ SCIP_RETCODE analyzeEnergyRequirement(
    /* collect global contribution and adjusted the required energy by the amount of energy the inference variable
     * takes
     */
-   for( v = 0; v < nvars; ++v )
+   for( c = 0; c < ncands; ++c )
    {
       SCIP_VAR* var;
       int glbenergy;
@@ -2924,12 +3193,15 @@ SCIP_RETCODE analyzeEnergyRequirement(
       int est;
       int lst;
 
+      v = (jobs != NULL ? jobs[c] : c);
+      assert(v >= 0 && v < nvars);
+
       var = vars[v];
       assert(var != NULL);
 
-      locenergies[v] = 0;
-      overlaps[v] = 0;
-      idxs[v] = v;
+      locenergies[c] = 0;
+      overlaps[c] = 0;
+      idxs[c] = v;
 
       demand = demands[v];
       assert(demand > 0);
@@ -3085,19 +3357,19 @@ SCIP_RETCODE analyzeEnergyRequirement(
        */
       if( est + duration > begin && lst < end )
       {
-         overlaps[v] = computeOverlap(begin, end, est, lst, duration);
+         overlaps[c] = computeOverlap(begin, end, est, lst, duration);
 
          /* evaluated additionally local energy contribution */
-         locenergies[v] = overlaps[v] * demand - glbenergy;
-         assert(locenergies[v] >= 0);
+         locenergies[c] = overlaps[c] * demand - glbenergy;
+         assert(locenergies[c] >= 0);
       }
    }
 
    /* sort the variable contributions w.r.t. additional local energy contributions */
-   SCIPsortDownIntIntInt(locenergies, overlaps, idxs, nvars);
+   SCIPsortDownIntIntInt(locenergies, overlaps, idxs, ncands);
 
    /* add local energy contributions until an overload is implied */
-   for( v = 0; v < nvars && requiredenergy >= 0; ++v )
+   for( v = 0; v < ncands && requiredenergy >= 0; ++v )
    {
       SCIP_VAR* var;
       int duration;
@@ -3168,6 +3440,7 @@ SCIP_RETCODE analyzeEnergyRequirement(
 static
 SCIP_RETCODE respropCumulativeCondition(
    SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< data of the cumulative constraint with stored explanations, or NULL */
    int                   nvars,              /**< number of start time variables (activities) */
    SCIP_VAR**            vars,               /**< array of start time variables */
    int*                  durations,          /**< array of durations */
@@ -3306,6 +3579,8 @@ SCIP_RETCODE respropCumulativeCondition(
    case PROPRULE_2_EDGEFINDING:
    case PROPRULE_3_TTEF:
    {
+      int* jobs;
+      int njobs;
       int begin;
       int end;
 
@@ -3313,10 +3588,19 @@ SCIP_RETCODE respropCumulativeCondition(
       end = inferInfoGetData2(inferinfo);
       assert(begin < end);
 
+      /* restrict the explanation to the jobs which could run within the time window when the bound was changed */
+      if( consdata != NULL )
+         jobs = consdataGetExplanation(scip, consdata, begin, end, &njobs);
+      else
+      {
+         jobs = NULL;
+         njobs = 0;
+      }
+
       begin = MAX(begin, hmin);
       end = MIN(end, hmax);
 
-      SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+      SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, jobs, njobs,
             begin, end, infervar, boundtype, bdchgidx, relaxedbd, usebdwidening, explanation) );
 
       break;
@@ -4541,7 +4825,7 @@ SCIP_RETCODE tightenLbTTEF(
          SCIP_CALL( SCIPaddConflictUb(scip, var, NULL) );
 
          /* analyze the infeasible */
-         SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+         SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, NULL, 0,
                begin, end, var, SCIP_BOUNDTYPE_LOWER, NULL, relaxedbd, conshdlrdata->usebdwidening, explanation) );
 
          (*initialized) = TRUE;
@@ -4655,7 +4939,7 @@ SCIP_RETCODE tightenUbTTEF(
          SCIP_CALL( SCIPaddConflictLb(scip, var, NULL) );
 
          /* analyze the infeasible */
-         SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+         SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, NULL, 0,
                begin, end, var, SCIP_BOUNDTYPE_UPPER, NULL, relaxedbd, conshdlrdata->usebdwidening, explanation) );
 
          (*initialized) = TRUE;
@@ -4949,7 +5233,7 @@ SCIP_RETCODE propagateUbTTEF(
                /* analyze infeasibilty */
                SCIP_CALL( SCIPinitConflictAnalysis(scip, SCIP_CONFTYPE_PROPAGATION, FALSE) );
 
-               SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+               SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, NULL, 0,
                      begin, end, NULL, SCIP_BOUNDTYPE_UPPER, NULL, SCIP_UNKNOWN,
                      conshdlrdata->usebdwidening, explanation) );
 
@@ -4994,7 +5278,7 @@ SCIP_RETCODE propagateUbTTEF(
                   /* added to upper bound (which was overcut be new lower bound) of the variable */
                   SCIP_CALL( SCIPaddConflictUb(scip, vars[lbcand], NULL) );
 
-                  SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+                  SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, NULL, 0,
                         begin, end, vars[lbcand], SCIP_BOUNDTYPE_LOWER, NULL, relaxedbd,
                         conshdlrdata->usebdwidening, explanation) );
 
@@ -5278,7 +5562,7 @@ SCIP_RETCODE propagateLbTTEF(
                /* analyze infeasibilty */
                SCIP_CALL( SCIPinitConflictAnalysis(scip, SCIP_CONFTYPE_PROPAGATION, FALSE) );
 
-               SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+               SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, NULL, 0,
                      begin, end, NULL, SCIP_BOUNDTYPE_UPPER, NULL, SCIP_UNKNOWN,
                      conshdlrdata->usebdwidening, explanation) );
 
@@ -5325,7 +5609,7 @@ SCIP_RETCODE propagateLbTTEF(
                   /* added to lower bound (which was undercut be new upper bound) of the variable */
                   SCIP_CALL( SCIPaddConflictUb(scip, vars[ubcand], NULL) );
 
-                  SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+                  SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, NULL, 0,
                         begin, end, vars[ubcand], SCIP_BOUNDTYPE_UPPER, NULL, relaxedbd,
                         conshdlrdata->usebdwidening, explanation) );
 
@@ -5471,6 +5755,7 @@ SCIP_RETCODE propagateTTEF(
 
       if( inferInfoIsValid(intToInferInfo(lbinferinfos[v])) )
       {
+         SCIP_CALL( storeExplanation(scip, cons, vars[v], v, intToInferInfo(lbinferinfos[v])) );
          SCIP_CALL( SCIPinferVarLbCons(scip, vars[v], (SCIP_Real)newlbs[v], cons, lbinferinfos[v],
                TRUE, &infeasible, &tightened) );
       }
@@ -5492,6 +5777,7 @@ SCIP_RETCODE propagateTTEF(
 
       if( inferInfoIsValid(intToInferInfo(ubinferinfos[v])) )
       {
+         SCIP_CALL( storeExplanation(scip, cons, vars[v], v, intToInferInfo(ubinferinfos[v])) );
          SCIP_CALL( SCIPinferVarUbCons(scip, vars[v], (SCIP_Real)newubs[v], cons, ubinferinfos[v],
                TRUE, &infeasible, &tightened) );
       }
@@ -5534,7 +5820,7 @@ SCIP_RETCODE propagateTTEF(
             SCIP_CALL( SCIPaddConflictLb(scip, var, NULL) );
 
             /* analysis the upper bound change */
-            SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity,
+            SCIP_CALL( analyzeEnergyRequirement(scip, nvars, vars, durations, demands, capacity, NULL, 0,
                   begin, end, var, SCIP_BOUNDTYPE_UPPER, NULL, SCIPvarGetLbLocal(vars[v]) - 1.0,
                   conshdlrdata->usebdwidening, explanation) );
 
@@ -5976,121 +6262,103 @@ SCIP_RETCODE moveNodeToLambda(
    return SCIP_OKAY;
 }
 
-/** inserts a node into the theta set and update the envelops */
+/** creates a balanced subtree over the given leaves, which are sorted w.r.t. their keys; the inner nodes have empty
+ *  theta and lambda sets and use the key of the rightmost leaf of their left subtree as search key
+ *
+ *  @note building the tree in advance guarantees a depth of O(log n); inserting the jobs one after the other in the
+ *        order of their latest completion times degenerates to a list if these are sorted as the earliest start times
+ */
 static
-SCIP_RETCODE insertThetanode(
-   SCIP*                 scip,               /**< SCIP data structure */
+SCIP_RETCODE createThetaSubtree(
    SCIP_BT*              tree,               /**< binary tree */
-   SCIP_BTNODE*          node,               /**< node to insert */
+   SCIP_BTNODE**         leaves,             /**< leaves sorted w.r.t. their keys */
+   int                   first,              /**< position of the first leaf of the subtree */
+   int                   last,               /**< position of the last leaf of the subtree */
    SCIP_NODEDATA*        nodedatas,          /**< array of node data */
    int*                  nodedataidx,        /**< array of indices for node data */
-   int*                  nnodedatas          /**< pointer to number of node data */
+   int*                  nnodedatas,         /**< pointer to number of node data */
+   SCIP_BTNODE**         subtree             /**< pointer to store the root of the subtree */
    )
 {
-   /* if the tree is empty the node will be the root node */
-   if( SCIPbtIsEmpty(tree) )
+   SCIP_NODEDATA* newnodedata;
+   SCIP_BTNODE* left;
+   SCIP_BTNODE* right;
+   int mid;
+
+   assert(first <= last);
+
+   if( first == last )
    {
-      SCIPbtSetRoot(tree, node);
+      *subtree = leaves[first];
+      return SCIP_OKAY;
    }
-   else
-   {
-      SCIP_NODEDATA* newnodedata;
-      SCIP_NODEDATA* leafdata;
-      SCIP_NODEDATA* nodedata;
-      SCIP_BTNODE* leaf;
-      SCIP_BTNODE* newnode;
-      SCIP_BTNODE* parent;
 
-      leaf = SCIPbtGetRoot(tree);
-      assert(leaf != NULL);
+   mid = (first + last) / 2;
 
-      leafdata = (SCIP_NODEDATA*)SCIPbtnodeGetData(leaf);
-      assert(leafdata != NULL);
+   SCIP_CALL( createThetaSubtree(tree, leaves, first, mid, nodedatas, nodedataidx, nnodedatas, &left) );
+   SCIP_CALL( createThetaSubtree(tree, leaves, mid + 1, last, nodedatas, nodedataidx, nnodedatas, &right) );
 
-      nodedata = (SCIP_NODEDATA*)SCIPbtnodeGetData(node);
-      assert(nodedata != NULL);
-      assert(nodedata->intheta);
+   /* store node data to be able to delete them latter */
+   newnodedata = &nodedatas[*nnodedatas];
+   nodedataidx[*nnodedatas] = *nnodedatas;
+   ++(*nnodedatas);
 
-      /* find the position to insert the node */
-      while( !SCIPbtnodeIsLeaf(leaf) )
-      {
-         if( nodedata->key < leafdata->key )
-            leaf = SCIPbtnodeGetLeftchild(leaf);
-         else
-            leaf = SCIPbtnodeGetRightchild(leaf);
+   /* init node data */
+   newnodedata->var = NULL;
+   newnodedata->key = ((SCIP_NODEDATA*)SCIPbtnodeGetData(leaves[mid]))->key;
+   newnodedata->est = INT_MIN;
+   newnodedata->lct = INT_MAX;
+   newnodedata->duration = 0;
+   newnodedata->demand = 0;
+   newnodedata->enveloptheta = -1;
+   newnodedata->energytheta = 0;
+   newnodedata->enveloplambda = -1;
+   newnodedata->energylambda = -1;
+   newnodedata->idx = -1;
+   newnodedata->intheta = TRUE;
 
-         leafdata = (SCIP_NODEDATA*)SCIPbtnodeGetData(leaf);
-         assert(leafdata != NULL);
-      }
+   /* create a new node */
+   SCIP_CALL( SCIPbtnodeCreate(tree, subtree, newnodedata) );
+   assert(*subtree != NULL);
 
-      assert(leaf != NULL);
-      assert(leaf != node);
-
-      /* store node data to be able to delete them latter */
-      newnodedata = &nodedatas[*nnodedatas];
-      nodedataidx[*nnodedatas] = *nnodedatas;
-      ++(*nnodedatas);
-
-      /* init node data */
-      newnodedata->var = NULL;
-      newnodedata->key = SCIP_INVALID;
-      newnodedata->est = INT_MIN;
-      newnodedata->lct = INT_MAX;
-      newnodedata->duration = 0;
-      newnodedata->demand = 0;
-      newnodedata->enveloptheta = -1;
-      newnodedata->energytheta = 0;
-      newnodedata->enveloplambda = -1;
-      newnodedata->energylambda = -1;
-      newnodedata->idx = -1;
-      newnodedata->intheta = TRUE;
-
-      /* create a new node */
-      SCIP_CALL( SCIPbtnodeCreate(tree, &newnode, newnodedata) );
-      assert(newnode != NULL);
-
-      parent = SCIPbtnodeGetParent(leaf);
-
-      if( parent != NULL )
-      {
-         SCIPbtnodeSetParent(newnode, parent);
-
-         /* check if the node is the left child */
-         if( SCIPbtnodeGetLeftchild(parent) == leaf )
-         {
-            SCIPbtnodeSetLeftchild(parent, newnode);
-         }
-         else
-         {
-            SCIPbtnodeSetRightchild(parent, newnode);
-         }
-      }
-      else
-         SCIPbtSetRoot(tree, newnode);
+   SCIPbtnodeSetLeftchild(*subtree, left);
+   SCIPbtnodeSetRightchild(*subtree, right);
+   SCIPbtnodeSetParent(left, *subtree);
+   SCIPbtnodeSetParent(right, *subtree);
 
-      if( nodedata->key < leafdata->key )
-      {
-         /* node is on the left */
-         SCIPbtnodeSetLeftchild(newnode, node);
-         SCIPbtnodeSetRightchild(newnode, leaf);
-         newnodedata->key = nodedata->key;
-      }
-      else
-      {
-         /* leaf is on the left */
-         SCIPbtnodeSetLeftchild(newnode, leaf);
-         SCIPbtnodeSetRightchild(newnode, node);
-         newnodedata->key = leafdata->key;
-      }
+   return SCIP_OKAY;
+}
 
-      SCIPbtnodeSetParent(leaf, newnode);
-      SCIPbtnodeSetParent(node, newnode);
-   }
+/** inserts a leaf of the tree into the theta set and update the envelops */
+static
+void insertThetanode(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_BTNODE*          node,               /**< leaf to insert */
+   int                   capacity            /**< cumulative capacity */
+   )
+{
+   SCIP_NODEDATA* nodedata;
+   int energy;
+
+   assert(SCIPbtnodeIsLeaf(node));
+
+   nodedata = (SCIP_NODEDATA*)SCIPbtnodeGetData(node);
+   assert(nodedata != NULL);
+   assert(!nodedata->intheta);
+
+   energy = nodedata->demand * (nodedata->duration - nodedata->leftadjust - nodedata->rightadjust);
+   assert(energy > 0);
+
+   /* the envelop is the energy of the job plus the total amount of energy which is available in the time period
+    * before that job can start, that is [0,est). The envelop is later used to compare the energy consumption of a
+    * particular time interval [a,b] against the time interval [0,b].
+    */
+   nodedata->enveloptheta = (SCIP_Longint) capacity * nodedata->est + energy;
+   nodedata->energytheta = energy;
+   nodedata->intheta = TRUE;
 
    /* update envelop */
    updateEnvelope(scip, node);
-
-   return SCIP_OKAY;
 }
 
 /** returns the leaf responsible for the lambda energy */
@@ -6450,6 +6718,24 @@ SCIP_DECL_SORTPTRCOMP(compNodeEst)
    return (est1 - est2);
 }
 
+/** comparison method for two node data w.r.t. the search key */
+static
+SCIP_DECL_SORTPTRCOMP(compNodeKey)
+{
+   SCIP_Real key1;
+   SCIP_Real key2;
+
+   key1 = ((SCIP_NODEDATA*)SCIPbtnodeGetData((SCIP_BTNODE*)elem1))->key;
+   key2 = ((SCIP_NODEDATA*)SCIPbtnodeGetData((SCIP_BTNODE*)elem2))->key;
+
+   if( key1 < key2 )
+      return -1;
+   else if( key1 > key2 )
+      return 1;
+   else
+      return 0;
+}
+
 /** comparison method for two node data w.r.t. the latest completion time */
 static
 SCIP_DECL_SORTINDCOMP(compNodedataLct)
@@ -6726,6 +7012,7 @@ SCIP_RETCODE inferboundsEdgeFinding(
 
                if( inferInfoIsValid(inferinfo) )
                {
+                  SCIP_CALL( storeExplanation(scip, cons, leafdata->var, leafdata->idx, inferinfo) );
                   SCIP_CALL( SCIPinferVarLbCons(scip, leafdata->var, (SCIP_Real)(newest + shift),
                         cons, inferInfoToInt(inferinfo), TRUE, &infeasible, &tightened) );
                }
@@ -6748,6 +7035,7 @@ SCIP_RETCODE inferboundsEdgeFinding(
 
                if( inferInfoIsValid(inferinfo) )
                {
+                  SCIP_CALL( storeExplanation(scip, cons, leafdata->var, leafdata->idx, inferinfo) );
                   SCIP_CALL( SCIPinferVarUbCons(scip, leafdata->var, (SCIP_Real)(shift - newest - leafdata->duration),
                         cons, inferInfoToInt(inferinfo), TRUE, &infeasible, &tightened) );
                }
@@ -6853,6 +7141,8 @@ SCIP_RETCODE checkOverloadViaThetaTree(
    )
 {
    SCIP_NODEDATA* nodedatas;
+   SCIP_BTNODE** sortedleaves;
+   SCIP_BTNODE** candleaves;
    SCIP_BTNODE** leaves;
    SCIP_BT* tree;
    int* nodedataidx;
@@ -6860,6 +7150,7 @@ SCIP_RETCODE checkOverloadViaThetaTree(
    int totalenergy;
    int nnodedatas;
    int ninsertcands;
+   int nleaves;
    int ncands;
 
    int shift;
@@ -6877,6 +7168,8 @@ SCIP_RETCODE checkOverloadViaThetaTree(
    SCIP_CALL( SCIPallocBufferArray(scip, &nodedatas, 2*nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &nodedataidx, 2*nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &leaves, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sortedleaves, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candleaves, nvars) );
 
    ncands = 0;
    totalenergy = 0;
@@ -6993,20 +7286,49 @@ SCIP_RETCODE checkOverloadViaThetaTree(
       nodedata->leftadjust = leftadjust;
       nodedata->rightadjust = rightadjust;
 
-      /* the envelop is the energy of the job plus the total amount of energy which is available in the time period
-       * before that job can start, that is [0,est). The envelop is later used to compare the energy consumption of a
-       * particular time interval [a,b] against the time interval [0,b].
-       */
-      nodedata->enveloptheta = (SCIP_Longint) capacity * est + energy;
-      nodedata->energytheta = energy;
+      /* the job is inserted into the theta set below */
+      nodedata->enveloptheta = -1;
+      nodedata->energytheta = 0;
       nodedata->enveloplambda = -1;
       nodedata->energylambda = -1;
 
       nodedata->idx = j;
-      nodedata->intheta = TRUE;
+      nodedata->intheta = FALSE;
    }
 
    nnodedatas = ncands;
+   nleaves = 0;
+
+   /* create the leaves of all jobs which do not open a time window which size is so large that it offers more energy
+    * than the total energy of all candidate jobs; the earliest start time of all other jobs is set to minus one to mark
+    * them as not used
+    */
+   for( j = 0; j < ncands; ++j )
+   {
+      if( ((SCIP_Longint) nodedatas[j].lct - nodedatas[j].est) * capacity >= totalenergy )
+      {
+         nodedatas[j].est = -1;
+         candleaves[j] = NULL;
+         continue;
+      }
+
+      SCIP_CALL( SCIPbtnodeCreate(tree, &candleaves[j], (void*)&nodedatas[j]) );
+      sortedleaves[nleaves] = candleaves[j];
+      ++nleaves;
+   }
+
+   /* create a balanced tree with empty theta and lambda sets over all leaves */
+   if( nleaves > 0 )
+   {
+      SCIP_BTNODE* root;
+
+      SCIPsortPtr((void**)sortedleaves, compNodeKey, nleaves);
+
+      SCIP_CALL( createThetaSubtree(tree, sortedleaves, 0, nleaves - 1, nodedatas, nodedataidx, &nnodedatas, &root) );
+      assert(nnodedatas <= 2*nvars);
+
+      SCIPbtSetRoot(tree, root);
+   }
 
    /* sort (non-decreasing) the jobs w.r.t. latest completion times */
    SCIPsortInd(nodedataidx, compNodedataLct, (void*)nodedatas, ncands);
@@ -7023,22 +7345,14 @@ SCIP_RETCODE checkOverloadViaThetaTree(
 
       idx = nodedataidx[j];
 
-      /* check if the new job opens a time window which size is so large that it offers more energy than the total
-       * energy of all candidate jobs. If so we skip that one.
-       */
-      if( ((SCIP_Longint) nodedatas[idx].lct - nodedatas[idx].est) * capacity >= totalenergy )
-      {
-         /* set the earliest start time to minus one to mark that candidate to be not used */
-         nodedatas[idx].est = -1;
+      /* skip jobs which open a too large time window */
+      if( nodedatas[idx].est == -1 )
          continue;
-      }
 
-      /* create search node */
-      SCIP_CALL( SCIPbtnodeCreate(tree, &leaf, (void*)&nodedatas[idx]) );
-
-      /* insert new node into the theta set and updete the envelops */
-      SCIP_CALL( insertThetanode(scip, tree, leaf, nodedatas, nodedataidx, &nnodedatas) );
-      assert(nnodedatas <= 2*nvars);
+      /* insert the leaf of the job into the theta set and update the envelops */
+      leaf = candleaves[idx];
+      assert(leaf != NULL);
+      insertThetanode(scip, leaf, capacity);
 
       /* move the inserted candidates together */
       leaves[ninsertcands] = leaf;
@@ -7124,6 +7438,8 @@ SCIP_RETCODE checkOverloadViaThetaTree(
    SCIPbtFree(&tree);
 
    /* free buffer arrays */
+   SCIPfreeBufferArray(scip, &candleaves);
+   SCIPfreeBufferArray(scip, &sortedleaves);
    SCIPfreeBufferArray(scip, &leaves);
    SCIPfreeBufferArray(scip, &nodedataidx);
    SCIPfreeBufferArray(scip, &nodedatas);
@@ -7325,20 +7641,31 @@ SCIP_RETCODE createCoreProfile(
    SCIP_Bool*            cutoff              /**< pointer to store if the constraint is infeasible */
    )
 {
+   int* begins;
+   int* ends;
+   int* coredemands;
+   int* corevars;
+   SCIP_Bool infeasible;
+   int ncores;
+   int c;
    int v;
 
-   /* insert all cores */
+   SCIP_CALL( SCIPallocBufferArray(scip, &begins, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ends, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &coredemands, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &corevars, nvars) );
+
+   /* collect all cores */
+   ncores = 0;
    for( v = 0; v < nvars; ++v )
    {
       SCIP_VAR* var;
-      SCIP_Bool infeasible;
       int duration;
       int demand;
       int begin;
       int end;
       int est;
       int lst;
-      int pos;
 
       var = vars[v];
       assert(var != NULL);
@@ -7370,31 +7697,58 @@ SCIP_RETCODE createCoreProfile(
       SCIPdebugMsg(scip, "variable <%s>[%d,%d] (duration %d, demand %d): add core [%d,%d)\n",
          SCIPvarGetName(var), est, lst, duration, demand, begin, end);
 
-      /* insert the core into core resource profile (complexity O(log n)) */
-      SCIP_CALL( SCIPprofileInsertCore(profile, begin, end, demand, &pos, &infeasible) );
+      begins[ncores] = begin;
+      ends[ncores] = end;
+      coredemands[ncores] = demand;
+      corevars[ncores] = v;
+      ++ncores;
+   }
 
-      /* in case the insertion of the core leads to an infeasibility; start the conflict analysis */
-      if( infeasible )
+   /* insert all cores at once into the core resource profile (complexity O(n log n)) */
+   SCIP_CALL( SCIPprofileInsertCores(profile, ncores, begins, ends, coredemands, &infeasible) );
+
+   /* in case the cores do not fit, the resource profile is unchanged; insert the cores one after the other to find the
+    * core which leads to the infeasibility and start the conflict analysis
+    */
+   if( infeasible )
+   {
+      for( c = 0; c < ncores; ++c )
       {
-         assert(begin <= SCIPprofileGetTime(profile, pos));
-         assert(end > SCIPprofileGetTime(profile, pos));
+         int pos;
 
-         /* use conflict analysis to analysis the core insertion which was infeasible */
-         SCIP_CALL( analyseInfeasibelCoreInsertion(scip, nvars, vars, durations, demands, capacity, hmin, hmax,
-               var, duration, demand, SCIPprofileGetTime(profile, pos), conshdlrdata->usebdwidening, initialized, explanation) );
+         v = corevars[c];
 
-         if( explanation != NULL )
-            explanation[v] = TRUE;
+         SCIP_CALL( SCIPprofileInsertCore(profile, begins[c], ends[c], coredemands[c], &pos, &infeasible) );
 
-         (*cutoff) = TRUE;
+         if( infeasible )
+         {
+            assert(begins[c] <= SCIPprofileGetTime(profile, pos));
+            assert(ends[c] > SCIPprofileGetTime(profile, pos));
 
-         /* for the statistic we count the number of times a cutoff was detected due the time-time */
-         SCIPstatistic( SCIPconshdlrGetData(SCIPfindConshdlr(scip, CONSHDLR_NAME))->ncutofftimetable++ );
+            /* use conflict analysis to analysis the core insertion which was infeasible */
+            SCIP_CALL( analyseInfeasibelCoreInsertion(scip, nvars, vars, durations, demands, capacity, hmin, hmax,
+                  vars[v], durations[v], coredemands[c], SCIPprofileGetTime(profile, pos),
+                  conshdlrdata->usebdwidening, initialized, explanation) );
 
-         break;
+            if( explanation != NULL )
+               explanation[v] = TRUE;
+
+            (*cutoff) = TRUE;
+
+            /* for the statistic we count the number of times a cutoff was detected due the time-time */
+            SCIPstatistic( SCIPconshdlrGetData(SCIPfindConshdlr(scip, CONSHDLR_NAME))->ncutofftimetable++ );
+
+            break;
+         }
       }
+      assert(*cutoff);
    }
 
+   SCIPfreeBufferArray(scip, &corevars);
+   SCIPfreeBufferArray(scip, &coredemands);
+   SCIPfreeBufferArray(scip, &ends);
+   SCIPfreeBufferArray(scip, &begins);
+
    return SCIP_OKAY;
 }
 
@@ -12774,6 +13128,9 @@ SCIP_DECL_CONSEXITSOL(consExitsolCumulative)
 
       /* free rows */
       SCIP_CALL( consdataFreeRows(scip, &consdata) );
+
+      /* the stored explanations refer to nodes of the current search tree */
+      consdataFreeExplanations(scip, consdata);
    }
 
    return SCIP_OKAY;
@@ -13318,8 +13675,8 @@ SCIP_DECL_CONSRESPROP(consRespropCumulative)
       SCIPvarGetName(infervar), SCIPconsGetName(cons), consdata->capacity, inferInfoGetProprule(intToInferInfo(inferinfo)),
       SCIPgetHminCumulative(scip, cons), SCIPgetHmaxCumulative(scip, cons));
 
-   SCIP_CALL( respropCumulativeCondition(scip, consdata->nvars, consdata->vars,
-         consdata->durations, consdata->demands, consdata->capacity, consdata->hmin, consdata->hmax,
+   SCIP_CALL( respropCumulativeCondition(scip, conshdlrdata->storeexplanations ? consdata : NULL, consdata->nvars,
+         consdata->vars, consdata->durations, consdata->demands, consdata->capacity, consdata->hmin, consdata->hmax,
          infervar, intToInferInfo(inferinfo), boundtype, bdchgidx, relaxedbd, conshdlrdata->usebdwidening, NULL, result) );
 
    return SCIP_OKAY;
@@ -13751,6 +14108,10 @@ SCIP_RETCODE SCIPincludeConshdlrCumulative(
    SCIP_CALL( SCIPaddBoolParam(scip,
          "constraints/" CONSHDLR_NAME "/usebdwidening", "should bound widening be used during the conflict analysis?",
          &conshdlrdata->usebdwidening, FALSE, DEFAULT_USEBDWIDENING, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "constraints/" CONSHDLR_NAME "/storeexplanations",
+         "should the jobs explaining energy-based bound changes be stored during propagation instead of being collected in conflict analysis?",
+         &conshdlrdata->storeexplanations, FALSE, DEFAULT_STOREEXPLANATIONS, NULL, NULL) );
 
    return SCIP_OKAY;
 }
@@ -14211,7 +14572,7 @@ SCIP_RETCODE SCIPrespropCumulativeCondition(
    SCIP_RESULT*          result              /**< pointer to store the result of the propagation conflict resolving call */
    )
 {
-   SCIP_CALL( respropCumulativeCondition(scip, nvars, vars, durations, demands, capacity, hmin, hmax,
+   SCIP_CALL( respropCumulativeCondition(scip, NULL, nvars, vars, durations, demands, capacity, hmin, hmax,
          infervar, intToInferInfo(inferinfo), boundtype, bdchgidx, relaxedbd, TRUE, explanation, result) );
 
    return SCIP_OKAY;
@@ -13512,6 +13512,8 @@ SCIP_RETCODE SCIPincludeConshdlrKnapsack(
 
    assert(conshdlr != NULL);
 
+   SCIPconshdlrSetIndependentCheck(conshdlr, TRUE);
+
    /* set non-fundamental callbacks via specific setter functions */
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopyKnapsack, consCopyKnapsack) );
    SCIP_CALL( SCIPsetConshdlrActive(scip, conshdlr, consActiveKnapsack) );
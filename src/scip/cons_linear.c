@@ -17702,6 +17702,8 @@ SCIP_RETCODE SCIPincludeConshdlrLinear(
 
    assert(conshdlr != NULL);
 
+   SCIPconshdlrSetIndependentCheck(conshdlr, TRUE);
+
    /* set non-fundamental callbacks via specific setter functions */
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopyLinear, consCopyLinear) );
    SCIP_CALL( SCIPsetConshdlrActive(scip, conshdlr, consActiveLinear) );
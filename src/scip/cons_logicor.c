@@ -5343,6 +5343,8 @@ SCIP_RETCODE SCIPincludeConshdlrLogicor(
          conshdlrdata) );
    assert(conshdlr != NULL);
 
+   SCIPconshdlrSetIndependentCheck(conshdlr, TRUE);
+
    /* set non-fundamental callbacks via specific setter functions */
    SCIP_CALL( SCIPsetConshdlrActive(scip, conshdlr, consActiveLogicor) );
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopyLogicor, consCopyLogicor) );
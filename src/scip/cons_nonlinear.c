@@ -233,6 +233,7 @@ struct SCIP_ConsData
    /* miscellaneous */
    SCIP_EXPRCURV         curv;               /**< curvature of the root expression w.r.t. the original variables */
    SCIP_NLROW*           nlrow;              /**< a nonlinear row representation of this constraint */
+   SCIP_EXPRTAPE*        tape;               /**< evaluation tape of expression, or NULL if not compiled (yet) */
    int                   consindex;          /**< an index of the constraint that is unique among all expr-constraints in this SCIP instance and is constant */
 };
 
@@ -318,6 +319,7 @@ struct SCIP_ConshdlrData
    SCIP_Real             branchpscostreliable; /**< minimum pseudo-cost update count required to consider pseudo-costs reliable */
    char                  linearizeheursol;   /**< whether tight linearizations of nonlinear constraints should be added to cutpool when some heuristics finds a new solution ('o'ff, on new 'i'ncumbents, on 'e'very solution) */
    SCIP_Bool             assumeconvex;       /**< whether to assume that any constraint is convex */
+   SCIP_Bool             evaltape;           /**< whether to evaluate constraints and their gradients via compiled evaluation tapes during solving */
 
    /* statistics */
    SCIP_Longint          nweaksepa;          /**< number of times we used "weak" cuts for enforcement */
@@ -1528,6 +1530,43 @@ SCIP_Real getExprAbsAuxViolation(
    return 0.0;
 }
 
+/** gives the evaluation tape of a constraint, compiling it if necessary
+ *
+ * Tapes are only used during solving, since the expressions are not modified anymore then.
+ * Returns NULL if tapes are disabled or not available.
+ */
+static
+SCIP_RETCODE getConsEvalTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_EXPRTAPE**       tape                /**< buffer to store evaluation tape, or NULL */
+   )
+{
+   SCIP_CONSDATA* consdata;
+
+   assert(scip != NULL);
+   assert(cons != NULL);
+   assert(tape != NULL);
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+
+   *tape = NULL;
+
+   if( !SCIPconshdlrGetData(SCIPconsGetHdlr(cons))->evaltape || SCIPgetStage(scip) != SCIP_STAGE_SOLVING )
+      return SCIP_OKAY;
+
+   if( consdata->tape == NULL )
+   {
+      SCIP_CALL( SCIPcreateExprTape(scip, &consdata->tape, consdata->expr) );
+   }
+   assert(SCIPexprtapeGetRoot(consdata->tape) == consdata->expr);
+
+   *tape = consdata->tape;
+
+   return SCIP_OKAY;
+}
+
 /** computes violation of a constraint */
 static
 SCIP_RETCODE computeViolation(
@@ -1538,6 +1577,7 @@ SCIP_RETCODE computeViolation(
    )
 {
    SCIP_CONSDATA* consdata;
+   SCIP_EXPRTAPE* tape;
    SCIP_Real activity;
 
    assert(scip != NULL);
@@ -1546,7 +1586,15 @@ SCIP_RETCODE computeViolation(
    consdata = SCIPconsGetData(cons);
    assert(consdata != NULL);
 
-   SCIP_CALL( SCIPevalExpr(scip, consdata->expr, sol, soltag) );
+   SCIP_CALL( getConsEvalTape(scip, cons, &tape) );
+   if( tape != NULL )
+   {
+      SCIP_CALL( SCIPevalExprTape(scip, tape, sol, soltag) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPevalExpr(scip, consdata->expr, sol, soltag) );
+   }
    activity = SCIPexprGetEvalValue(consdata->expr);
 
    /* consider constraint as violated if it is undefined in the current point */
@@ -1599,6 +1647,7 @@ SCIP_RETCODE getConsRelViolation(
    SCIP_CONSHDLR* conshdlr;
    SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata;
+   SCIP_EXPRTAPE* tape;
    SCIP_Real scale;
 
    assert(cons != NULL);
@@ -1652,7 +1701,15 @@ SCIP_RETCODE getConsRelViolation(
       consdata->gradnorm = 0.0;
 
       /* compute gradient */
-      SCIP_CALL( SCIPevalExprGradient(scip, consdata->expr, sol, soltag) );
+      SCIP_CALL( getConsEvalTape(scip, cons, &tape) );
+      if( tape != NULL )
+      {
+         SCIP_CALL( SCIPevalExprTapeGradient(scip, tape, sol, soltag) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPevalExprGradient(scip, consdata->expr, sol, soltag) );
+      }
 
       /* gradient evaluation error -> no scaling */
       if( SCIPexprGetDerivative(consdata->expr) != SCIP_INVALID )
@@ -3741,6 +3798,12 @@ SCIP_RETCODE deinitSolve(
          }
       }
 
+      /* free evaluation tape, it is recompiled when needed in the next solve */
+      if( consdata->tape != NULL )
+      {
+         SCIP_CALL( SCIPfreeExprTape(scip, &consdata->tape) );
+      }
+
       if( consdata->nlrow != NULL )
       {
          /* remove row from NLP, if still in solving
@@ -10903,6 +10966,12 @@ SCIP_DECL_CONSDELETE(consDeleteNonlinear)
    /* free variable expressions */
    SCIP_CALL( freeVarExprs(scip, *consdata) );
 
+   /* free evaluation tape, which holds a reference to the expression */
+   if( (*consdata)->tape != NULL )
+   {
+      SCIP_CALL( SCIPfreeExprTape(scip, &(*consdata)->tape) );
+   }
+
    SCIP_CALL( SCIPreleaseExpr(scip, &(*consdata)->expr) );
 
    /* free nonlinear row representation */
@@ -12146,6 +12215,10 @@ SCIP_RETCODE SCIPincludeConshdlrNonlinear(
          "whether to assume that any constraint is convex",
          &conshdlrdata->assumeconvex, FALSE, FALSE, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/evaltape",
+         "whether to evaluate constraints and their gradients via compiled evaluation tapes during solving",
+         &conshdlrdata->evaltape, TRUE, FALSE, NULL, NULL) );
+
    /* include handler for bound change events */
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &conshdlrdata->eventhdlr, CONSHDLR_NAME "_boundchange",
          "signals a bound change to a nonlinear constraint", processVarEvent, NULL) );
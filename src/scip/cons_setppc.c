@@ -9271,6 +9271,8 @@ SCIP_RETCODE SCIPincludeConshdlrSetppc(
          conshdlrdata) );
    assert(conshdlr != NULL);
 
+   SCIPconshdlrSetIndependentCheck(conshdlr, TRUE);
+
    /* set non-fundamental callbacks via specific setter functions */
    SCIP_CALL( SCIPsetConshdlrActive(scip, conshdlr, consActiveSetppc) );
    SCIP_CALL( SCIPsetConshdlrDeactive(scip, conshdlr, consDeactiveSetppc) );
@@ -5337,6 +5337,8 @@ SCIP_RETCODE SCIPincludeConshdlrVarbound(
          conshdlrdata) );
    assert(conshdlr != NULL);
 
+   SCIPconshdlrSetIndependentCheck(conshdlr, TRUE);
+
    /* set non-fundamental callbacks via specific setter functions */
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopyVarbound, consCopyVarbound) );
    SCIP_CALL( SCIPsetConshdlrActive(scip, conshdlr, consActiveVarbound) );
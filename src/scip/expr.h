@@ -695,6 +695,69 @@ void SCIPexpriterFree(
 /**@} */
 
 
+/**@name Expression Evaluation Tape Methods */
+/**@{ */
+
+/** compiles an expression into an evaluation tape */
+SCIP_RETCODE SCIPexprtapeCreate(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            rootexpr,           /**< root expression to compile */
+   SCIP_EXPRTAPE**       tape                /**< buffer to store the created tape */
+   );
+
+/** frees an expression evaluation tape and releases its root expression */
+SCIP_RETCODE SCIPexprtapeFree(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPRTAPE**       tape                /**< pointer to the tape to free */
+   );
+
+/** evaluates the expression of a tape for a given point */
+SCIP_RETCODE SCIPexprtapeEval(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
+/** evaluates the gradient of the expression of a tape for a given point */
+SCIP_RETCODE SCIPexprtapeEvalGradient(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
+/** evaluates the expression of a tape for many points at once */
+SCIP_RETCODE SCIPexprtapeEvalBatch(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of the variables in all points (structure-of-arrays) */
+   SCIP_Real*            vals,               /**< array to store the values of the expression in all points */
+   SCIP_Real*            slotvals            /**< array of size ninstrs * npoints to store the values of all
+                                              *   instructions in all points, or NULL if not needed */
+   );
+
+/** evaluates the gradient of the expression of a tape for many points at once */
+SCIP_RETCODE SCIPexprtapeEvalBatchGradient(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            slotvals,           /**< values of all instructions in all points, see SCIPexprtapeEvalBatch() */
+   SCIP_Real*            vals,               /**< values of the expression in all points */
+   SCIP_Real*            grads               /**< array of size nvars * npoints to store the gradients in all points */
+   );
+
+/**@} */
+
+
 /**@name Quadratic expression functions */
 /**@{ */
 
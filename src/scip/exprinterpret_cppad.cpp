@@ -34,7 +34,9 @@
 #include "scip/def.h"
 #include "scip/intervalarith.h"
 #include "scip/pub_expr.h"
+#include "scip/pub_misc.h"
 #include "scip/scip_expr.h"
+#include "scip/scip_param.h"
 #include "scip/expr_pow.h"
 #include "scip/expr_exp.h"
 #include "scip/expr_log.h"
@@ -43,6 +45,8 @@
 #include <cmath>
 #include <cstring>
 #include <algorithm>
+#include <string>
+#include <unordered_map>
 #include <vector>
 using std::vector;
 
@@ -175,6 +179,67 @@ using CppAD::AD;
 
 class atomic_userexpr;
 
+/** data of an expression that can be reused for all expressions with the same structure
+ *
+ * Two expressions have the same structure if they are equal up to renumbering of the variables, where the
+ * order of the variable indices needs to be the same. The data is stored w.r.t. positions of variables in
+ * the sorted vector of variable indices, so it is independent of the actual variable indices.
+ */
+struct ExprIntCacheEntry
+{
+public:
+   /** constructor */
+   ExprIntCacheEntry()
+      : hastape(false),
+        hassparsity(false),
+        hascoloring(false),
+        hesnnz(0)
+   { }
+
+   std::string           key;                /**< key that identifies the structure of the expressions */
+
+   bool                  hastape;            /**< whether the (optimized) tape f has been stored */
+   bool                  hassparsity;        /**< whether the Hessian sparsity has been stored */
+   bool                  hascoloring;        /**< whether the coloring of the Hessian sparsity has been stored */
+
+   CppAD::ADFun<double>  f;                  /**< the function to evaluate as CppAD object */
+
+   int                   hesnnz;             /**< number of nonzeros in lower-triangular part of Hessian */
+   vector<int>           hesrowpos;          /**< row positions of lower-triangular Hessian sparsity */
+   vector<int>           hescolpos;          /**< column positions of lower-triangular Hessian sparsity */
+   CppAD::local::internal_sparsity<bool>::pattern_type hessparsity_pattern;  /**< packed sparsity pattern of Hessian in CppAD-internal form */
+   CppAD::vector<size_t> hessparsity_row;    /**< row indices of sparsity pattern of Hessian in CppAD-internal form */
+   CppAD::vector<size_t> hessparsity_col;    /**< column indices of sparsity pattern of Hessian in CppAD-internal form */
+   CppAD::sparse_hessian_work heswork;       /**< work memory of CppAD for sparse Hessians, holding the coloring */
+};
+
+/** expression interpreter
+ *
+ * Holds a cache of tapes and Hessian sparsity patterns, keyed by the structure of the expressions, so that
+ * expressions with the same structure that are compiled by this interpreter are taped and colored only once.
+ * The number of cached structures is limited by the parameter nlp/exprintcachesize.
+ */
+struct SCIP_ExprInt
+{
+public:
+   /** constructor */
+   SCIP_ExprInt(
+      int                maxcachesize_       /**< maximal number of cached expression structures */
+      )
+      : maxcachesize(maxcachesize_)
+   { }
+
+   /** destructor */
+   ~SCIP_ExprInt()
+   {
+      for( std::unordered_multimap<unsigned int, ExprIntCacheEntry*>::iterator it(cache.begin()); it != cache.end(); ++it )
+         delete it->second;
+   }
+
+   int                   maxcachesize;       /**< maximal number of cached expression structures */
+   std::unordered_multimap<unsigned int, ExprIntCacheEntry*> cache; /**< cached data for expressions, by hash of their structure */
+};
+
 /** expression specific interpreter data */
 struct SCIP_ExprIntData
 {
@@ -188,7 +253,8 @@ public:
         hesrowidxs(NULL),
         hescolidxs(NULL),
         hesnnz(0),
-        hesconstant(false)
+        hesconstant(false),
+        cacheentry(NULL)
    { }
 
    /** destructor */
@@ -229,6 +295,8 @@ public:
    CppAD::vector<size_t> hessparsity_row;    /**< row indices of sparsity pattern of Hessian in CppAD-internal form */
    CppAD::vector<size_t> hessparsity_col;    /**< column indices of sparsity pattern of Hessian in CppAD-internal form */
    CppAD::sparse_hessian_work heswork;       /**< work memory of CppAD for sparse Hessians */
+
+   ExprIntCacheEntry*    cacheentry;         /**< data shared with expressions of the same structure, or NULL if not cacheable */
 };
 
 #ifndef NO_CPPAD_USER_ATOMIC
@@ -1452,6 +1520,102 @@ SCIP_RETCODE eval(
    return SCIP_OKAY;
 }
 
+/** appends the binary representation of a value to a cache key */
+template<class Type>
+static
+void appendCacheKey(
+   std::string&          key,                /**< cache key */
+   const Type&           value               /**< value to append */
+   )
+{
+   key.append(reinterpret_cast<const char*>(&value), sizeof(Type));
+}
+
+/** computes a key that identifies the structure of an expression, up to renumbering of variables, and its hash value
+ *
+ * The key lists the nodes of the expression tree in depth-first order, each with its handler, number of children,
+ * and handler data (variable position, constant, coefficients, exponent). The hash value is computed from the same
+ * data and is used to find the cache entry; since the key of the entry is then compared for equality, expressions
+ * that share a cache entry give the same tape even if their hash values collide.
+ *
+ * Only expressions whose handlers are taped by eval() and whose handler data is completely represented in the key
+ * can share a cache entry; for other expressions, cacheable is set to FALSE.
+ */
+static
+SCIP_RETCODE computeCacheKey(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            rootexpr,           /**< expression */
+   SCIP_EXPRINTDATA*     exprintdata,        /**< interpreter data for root expression */
+   std::string&          key,                /**< buffer to store key */
+   unsigned int&         hash,               /**< buffer to store hash value of key */
+   SCIP_Bool&            cacheable           /**< buffer to store whether the expression can be cached */
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_EXPR* expr;
+
+   key.clear();
+   hash = 0;
+   cacheable = TRUE;
+
+   SCIP_CALL( SCIPcreateExpriter(scip, &it) );
+   SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, TRUE) );
+
+   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it) && cacheable; expr = SCIPexpriterGetNext(it) )
+   {
+      const char* name = SCIPexprhdlrGetName(SCIPexprGetHdlr(expr));
+
+      key.append(name);
+      key.push_back('\0');
+      appendCacheKey(key, SCIPexprGetNChildren(expr));
+      hash = SCIPhashTwo(SCIPhashTwo(hash, std::hash<std::string>()(name)), SCIPexprGetNChildren(expr));
+
+      if( SCIPisExprVaridx(scip, expr) )
+      {
+         int pos = exprintdata->getVarPos(SCIPgetIndexExprVaridx(expr));
+
+         appendCacheKey(key, pos);
+         hash = SCIPhashTwo(hash, pos);
+      }
+      else if( SCIPisExprValue(scip, expr) )
+      {
+         appendCacheKey(key, SCIPgetValueExprValue(expr));
+         hash = SCIPhashTwo(hash, SCIPrealHashCode(SCIPgetValueExprValue(expr)));
+      }
+      else if( SCIPisExprSum(scip, expr) )
+      {
+         appendCacheKey(key, SCIPgetConstantExprSum(expr));
+         hash = SCIPhashTwo(hash, SCIPrealHashCode(SCIPgetConstantExprSum(expr)));
+         for( int i = 0; i < SCIPexprGetNChildren(expr); ++i )
+         {
+            appendCacheKey(key, SCIPgetCoefsExprSum(expr)[i]);
+            hash = SCIPhashTwo(hash, SCIPrealHashCode(SCIPgetCoefsExprSum(expr)[i]));
+         }
+      }
+      else if( SCIPisExprProduct(scip, expr) )
+      {
+         appendCacheKey(key, SCIPgetCoefExprProduct(expr));
+         hash = SCIPhashTwo(hash, SCIPrealHashCode(SCIPgetCoefExprProduct(expr)));
+      }
+      else if( SCIPisExprPower(scip, expr) || SCIPisExprSignpower(scip, expr) )
+      {
+         appendCacheKey(key, SCIPgetExponentExprPow(expr));
+         hash = SCIPhashTwo(hash, SCIPrealHashCode(SCIPgetExponentExprPow(expr)));
+      }
+      else if( !SCIPisExprExp(scip, expr) && !SCIPisExprLog(scip, expr) && strcmp(name, "abs") != 0
+         && strcmp(name, "sin") != 0 && strcmp(name, "cos") != 0 && strcmp(name, "erf") != 0
+         && strcmp(name, "entropy") != 0 )
+      {
+         /* the data of other handlers is not part of the key */
+         cacheable = FALSE;
+      }
+   }
+
+   SCIPfreeExpriter(&it);
+
+   return SCIP_OKAY;
+}
+
 /** replacement for CppAD's default error handler
  *
  *  In debug mode, CppAD gives an error when an evaluation contains a nan.
@@ -1500,9 +1664,13 @@ SCIP_RETCODE SCIPexprintCreate(
    SCIP_EXPRINT**        exprint             /**< buffer to store pointer to expression interpreter */
    )
 {
+   int maxcachesize;
+
    assert(exprint != NULL);
 
-   *exprint = (SCIP_EXPRINT*)1u;  /* some code checks that a non-NULL pointer is returned here, even though it may not point anywhere */
+   SCIP_CALL( SCIPgetIntParam(scip, "nlp/exprintcachesize", &maxcachesize) );
+
+   *exprint = new SCIP_EXPRINT(maxcachesize);
 
    return SCIP_OKAY;
 }
@@ -1514,7 +1682,9 @@ SCIP_RETCODE SCIPexprintFree(
    )
 {
    assert(exprint != NULL);
+   assert(*exprint != NULL);
 
+   delete *exprint;
    *exprint = NULL;
 
    return SCIP_OKAY;
@@ -1634,6 +1804,41 @@ SCIP_RETCODE SCIPexprintCompile(
       SCIPdebugMsg(scip, "Hessian found %sconstant\n", (*exprintdata)->hesconstant ? "" : "not ");
    }
 
+   // look up data for expressions with the same structure; only expressions that are taped completely by eval()
+   // without user expressions and that do not need retaping for every point can share their tape
+   (*exprintdata)->cacheentry = NULL;
+   if( exprint != NULL && exprint->maxcachesize > 0 && n > 0 && !(*exprintdata)->need_retape_always
+      && (*exprintdata)->userevalcapability == SCIP_EXPRINTCAPABILITY_ALL )
+   {
+      std::string key;
+      unsigned int hash;
+      SCIP_Bool cacheable;
+
+      SCIP_CALL( computeCacheKey(scip, rootexpr, *exprintdata, key, hash, cacheable) );
+
+      if( cacheable )
+      {
+         typedef std::unordered_multimap<unsigned int, ExprIntCacheEntry*>::iterator CacheIterator;
+         std::pair<CacheIterator, CacheIterator> range = exprint->cache.equal_range(hash);
+
+         for( CacheIterator entry = range.first; entry != range.second; ++entry )
+         {
+            if( entry->second->key == key )
+            {
+               (*exprintdata)->cacheentry = entry->second;
+               break;
+            }
+         }
+
+         if( (*exprintdata)->cacheentry == NULL && (int)exprint->cache.size() < exprint->maxcachesize )
+         {
+            (*exprintdata)->cacheentry = new ExprIntCacheEntry();
+            (*exprintdata)->cacheentry->key = key;
+            exprint->cache.insert(std::make_pair(hash, (*exprintdata)->cacheentry));
+         }
+      }
+   }
+
    return SCIP_OKAY;
 }
 
@@ -1707,6 +1912,7 @@ SCIP_RETCODE SCIPexprintEval(
       SCIPfreeBlockMemoryArrayNull(scip, &exprintdata->hescolidxs, exprintdata->hesnnz);
       exprintdata->hesvalues.clear();
       exprintdata->hesnnz = 0;
+      exprintdata->heswork.clear();
 
       for( size_t i = 0; i < n; ++i )
       {
@@ -1715,6 +1921,19 @@ SCIP_RETCODE SCIPexprintEval(
          exprintdata->x[i] = varvals[idx];  /* need this for a following grad or hessian eval with new_x = false */
       }
 
+      if( exprintdata->cacheentry != NULL && exprintdata->cacheentry->hastape )
+      {
+         // reuse the tape of an expression with the same structure
+         exprintdata->f = exprintdata->cacheentry->f;
+         exprintdata->val = exprintdata->f.Forward(0, exprintdata->x)[0];
+         exprintdata->need_retape = false;
+         SCIPdebugMessage("Eval reused cached tape and computed value %g\n", exprintdata->val);
+
+         *val = exprintdata->val;
+
+         return SCIP_OKAY;
+      }
+
       // delete old atomic_userexprs before we start collecting new ones
       for( vector<atomic_userexpr*>::iterator it(exprintdata->userexprs.begin()); it != exprintdata->userexprs.end(); ++it )
          delete *it;
@@ -1736,6 +1955,13 @@ SCIP_RETCODE SCIPexprintEval(
       exprintdata->f.optimize();
 
       exprintdata->need_retape = false;
+
+      if( exprintdata->cacheentry != NULL )
+      {
+         assert(exprintdata->userexprs.empty());
+         exprintdata->cacheentry->f = exprintdata->f;
+         exprintdata->cacheentry->hastape = true;
+      }
    }
    else
    {
@@ -1890,6 +2116,32 @@ SCIP_RETCODE SCIPexprintHessianSparsity(
          SCIP_CALL( SCIPexprintEval(scip, exprint, expr, exprintdata, varvals, &val) );
       }  /*lint !e438*/
 
+      if( exprintdata->cacheentry != NULL && exprintdata->cacheentry->hassparsity )
+      {
+         // reuse the sparsity pattern of an expression with the same structure
+         ExprIntCacheEntry* entry = exprintdata->cacheentry;
+
+         exprintdata->hesnnz = entry->hesnnz;
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &exprintdata->hesrowidxs, exprintdata->hesnnz) );
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &exprintdata->hescolidxs, exprintdata->hesnnz) );
+         for( int i = 0; i < exprintdata->hesnnz; ++i )
+         {
+            exprintdata->hesrowidxs[i] = exprintdata->varidxs[entry->hesrowpos[i]];
+            exprintdata->hescolidxs[i] = exprintdata->varidxs[entry->hescolpos[i]];
+         }
+
+         exprintdata->hessparsity_pattern = entry->hessparsity_pattern;
+         exprintdata->hessparsity_row = entry->hessparsity_row;
+         exprintdata->hessparsity_col = entry->hessparsity_col;
+         exprintdata->heswork.clear();
+
+         *rowidxs = exprintdata->hesrowidxs;
+         *colidxs = exprintdata->hescolidxs;
+         *nnz = exprintdata->hesnnz;
+
+         return SCIP_OKAY;
+      }
+
       // following https://github.com/coin-or/CppAD/blob/20180000.0/cppad_ipopt/src/vec_fun_pattern.cpp
 
       SCIPdebugMessage("calling ForSparseJac\n");
@@ -1970,6 +2222,24 @@ SCIP_RETCODE SCIPexprintHessianSparsity(
             ++j;
          }
 
+      if( exprintdata->cacheentry != NULL )
+      {
+         ExprIntCacheEntry* entry = exprintdata->cacheentry;
+
+         entry->hesnnz = exprintdata->hesnnz;
+         entry->hesrowpos.resize(exprintdata->hesnnz);
+         entry->hescolpos.resize(exprintdata->hesnnz);
+         for( int i = 0; i < exprintdata->hesnnz; ++i )
+         {
+            entry->hesrowpos[i] = (int)exprintdata->hessparsity_row[i];
+            entry->hescolpos[i] = (int)exprintdata->hessparsity_col[i];
+         }
+         entry->hessparsity_pattern = exprintdata->hessparsity_pattern;
+         entry->hessparsity_row = exprintdata->hessparsity_row;
+         entry->hessparsity_col = exprintdata->hessparsity_col;
+         entry->hassparsity = true;
+      }
+
 #ifdef SCIP_DEBUG
       SCIPinfoMessage(scip, NULL, "HessianSparsity for ");
       SCIP_CALL( SCIPprintExpr(scip, expr, NULL) );
@@ -2060,8 +2330,20 @@ SCIP_RETCODE SCIPexprintHessian(
          // originally, this was hess = exprintdata->f.SparseHessian(exprintdata->x, vector<double>(1, 1.0), exprintdata->hessparsity),
          //    where hess was a dense nxn matrix as in the case above
          // to reuse the coloring of the sparsity pattern and use also a sparse matrix for the Hessian values, we now call SparseHessianCompute directly
+         // if an expression with the same structure has been colored already, then we reuse its coloring
+         ExprIntCacheEntry* entry = exprintdata->cacheentry;
+         bool storecoloring = entry != NULL && !entry->hascoloring && exprintdata->heswork.color.size() == 0;
+         if( entry != NULL && entry->hascoloring && exprintdata->heswork.color.size() == 0 )
+            exprintdata->heswork = entry->heswork;
+
          exprintdata->f.SparseHessianCompute(exprintdata->x, vector<double>(1, 1.0), exprintdata->hessparsity_pattern, exprintdata->hessparsity_row, exprintdata->hessparsity_col, exprintdata->hesvalues, exprintdata->heswork);
 
+         if( storecoloring )
+         {
+            entry->heswork = exprintdata->heswork;
+            entry->hascoloring = true;
+         }
+
 #ifndef NDEBUG
          // hessparsity_row, hessparsity_col, hessparsity_pattern are no longer used by SparseHessianCompute after coloring has been computed in first call, except for some asserts, so we free some mem
          exprintdata->hessparsity_row.clear();
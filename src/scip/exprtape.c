@@ -0,0 +1,1004 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   exprtape.c
+ * @ingroup OTHER_CFILES
+ * @brief  evaluation tapes for algebraic expressions
+ *
+ * An evaluation tape is a flat sequence of instructions that is compiled once from an expression DAG. The
+ * instructions are stored in topological order, so that point evaluation and reverse-mode differentiation become
+ * simple loops over an array. Expressions of the basic handlers (var, val, sum, prod, pow, signpower, exp, log, abs)
+ * are evaluated by the tape itself, all other expressions are evaluated through the callbacks of their handlers.
+ *
+ * Evaluations on the tape store the values and derivatives in the expressions, as SCIPexprEval() and
+ * SCIPexprEvalGradient() do, so that the results can be accessed in the same way.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include "scip/expr.h"
+#include "scip/expr_pow.h"
+#include "scip/expr_product.h"
+#include "scip/expr_sum.h"
+#include "scip/expr_value.h"
+#include "scip/expr_var.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_message.h"
+#include "scip/scip_sol.h"
+#include "scip/set.h"
+#include "scip/struct_expr.h"
+#include "scip/struct_set.h"
+#include "scip/struct_stat.h"
+
+#define SIGN(x) ((x) >= 0.0 ? 1.0 : -1.0)
+
+/*
+ * local methods
+ */
+
+/** gives the operation code for an expression */
+static
+SCIP_EXPRTAPE_OPCODE getExprOpcode(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   const char* name;
+
+   if( SCIPexprIsVar(set, expr) )
+      return SCIP_EXPRTAPE_OP_VAR;
+   if( SCIPexprIsValue(set, expr) )
+      return SCIP_EXPRTAPE_OP_VALUE;
+   if( SCIPexprIsSum(set, expr) )
+      return SCIP_EXPRTAPE_OP_SUM;
+   if( SCIPexprIsProduct(set, expr) )
+      return SCIP_EXPRTAPE_OP_PRODUCT;
+   if( SCIPexprIsPower(set, expr) )
+      return SCIP_EXPRTAPE_OP_POW;
+
+   name = SCIPexprhdlrGetName(expr->exprhdlr);
+   if( strcmp(name, "signpower") == 0 )
+      return SCIP_EXPRTAPE_OP_SIGNPOWER;
+   if( strcmp(name, "exp") == 0 )
+      return SCIP_EXPRTAPE_OP_EXP;
+   if( strcmp(name, "log") == 0 )
+      return SCIP_EXPRTAPE_OP_LOG;
+   if( strcmp(name, "abs") == 0 )
+      return SCIP_EXPRTAPE_OP_ABS;
+
+   return SCIP_EXPRTAPE_OP_GENERIC;
+}
+
+/** computes the value of a unary instruction for a given argument value
+ *
+ * The evaluations are the same as in the corresponding expression handlers.
+ */
+static
+SCIP_Real evalUnaryInstr(
+   SCIP_EXPRTAPE_OPCODE  opcode,             /**< operation code */
+   SCIP_Real             coef,               /**< coefficient of instruction */
+   SCIP_Real             arg                 /**< value of argument */
+   )
+{
+   SCIP_Real val;
+
+   switch( opcode )
+   {
+      case SCIP_EXPRTAPE_OP_POW :
+         val = pow(arg, coef);
+         break;
+
+      case SCIP_EXPRTAPE_OP_SIGNPOWER :
+         val = SIGN(arg) * pow(REALABS(arg), coef);
+         break;
+
+      case SCIP_EXPRTAPE_OP_EXP :
+         return exp(arg);
+
+      case SCIP_EXPRTAPE_OP_LOG :
+         return arg <= 0.0 ? SCIP_INVALID : log(arg);
+
+      case SCIP_EXPRTAPE_OP_ABS :
+         return REALABS(arg);
+
+      default :
+         SCIPABORT();
+         return SCIP_INVALID; /*lint !e527*/
+   }
+
+   /* if there is a domain, pole, or range error, pow() should return some kind of NaN, infinity, or HUGE_VAL */
+   if( !SCIPisFinite(val) || val == HUGE_VAL || val == -HUGE_VAL ) /*lint !e777*/
+      return SCIP_INVALID;
+
+   return val;
+}
+
+/** computes the partial derivative of a unary instruction w.r.t. its argument
+ *
+ * The derivatives are the same as in the backward differentiation callbacks of the corresponding expression handlers.
+ */
+static
+SCIP_Real diffUnaryInstr(
+   SCIP_EXPRTAPE_OPCODE  opcode,             /**< operation code */
+   SCIP_Real             coef,               /**< coefficient of instruction */
+   SCIP_Real             arg,                /**< value of argument */
+   SCIP_Real             val                 /**< value of instruction */
+   )
+{
+   switch( opcode )
+   {
+      case SCIP_EXPRTAPE_OP_POW :
+         /* x^exponent is not differentiable for x = 0 and exponent in ]0,1[ */
+         if( coef > 0.0 && coef < 1.0 && arg == 0.0 )
+            return SCIP_INVALID;
+         return coef * pow(arg, coef - 1.0);
+
+      case SCIP_EXPRTAPE_OP_SIGNPOWER :
+         return coef * pow(REALABS(arg), coef - 1.0);
+
+      case SCIP_EXPRTAPE_OP_EXP :
+         return val;
+
+      case SCIP_EXPRTAPE_OP_LOG :
+         return 1.0 / arg;
+
+      case SCIP_EXPRTAPE_OP_ABS :
+         return arg >= 0.0 ? 1.0 : -1.0;
+
+      default :
+         SCIPABORT();
+         return SCIP_INVALID; /*lint !e527*/
+   }
+}
+
+/*
+ * public methods (internal API)
+ */
+
+/** compiles an expression into an evaluation tape
+ *
+ * The expression is captured by the tape. The tape becomes invalid if the expression or any of its subexpressions is
+ * modified.
+ */
+SCIP_RETCODE SCIPexprtapeCreate(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            rootexpr,           /**< root expression to compile */
+   SCIP_EXPRTAPE**       tape                /**< buffer to store the created tape */
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_HASHMAP* expr2slot;
+   SCIP_HASHMAP* var2idx;
+   SCIP_EXPR* expr;
+   int instrssize;
+   int argssize;
+   int varssize;
+
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(blkmem != NULL);
+   assert(rootexpr != NULL);
+   assert(tape != NULL);
+
+   SCIP_ALLOC( BMSallocClearBlockMemory(blkmem, tape) );
+   (*tape)->blkmem = blkmem;
+   (*tape)->root = rootexpr;
+   SCIPexprCapture(rootexpr);
+
+   instrssize = 16;
+   argssize = 16;
+   varssize = 8;
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->instrs, instrssize) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->args, argssize) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->argcoefs, argssize) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->vars, varssize) );
+
+   SCIP_CALL( SCIPhashmapCreate(&expr2slot, blkmem, 64) );
+   SCIP_CALL( SCIPhashmapCreate(&var2idx, blkmem, 16) );
+
+   /* visit each expression of the DAG once, after all its children, which gives a topological order */
+   SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
+   SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, FALSE) );
+   SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_LEAVEEXPR);
+
+   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+   {
+      SCIP_EXPRTAPEINSTR* instr;
+      int c;
+
+      if( (*tape)->ninstrs == instrssize )
+      {
+         int newsize = SCIPsetCalcMemGrowSize(set, instrssize + 1);
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->instrs, instrssize, newsize) );
+         instrssize = newsize;
+      }
+
+      if( (*tape)->nargs + expr->nchildren > argssize )
+      {
+         int newsize = SCIPsetCalcMemGrowSize(set, (*tape)->nargs + expr->nchildren);
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->args, argssize, newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->argcoefs, argssize, newsize) );
+         argssize = newsize;
+      }
+
+      instr = &(*tape)->instrs[(*tape)->ninstrs];
+      instr->expr = expr;
+      instr->opcode = getExprOpcode(set, expr);
+      instr->coef = 0.0;
+      instr->firstarg = (*tape)->nargs;
+      instr->nargs = expr->nchildren;
+      instr->varidx = -1;
+
+      for( c = 0; c < expr->nchildren; ++c )
+      {
+         assert(SCIPhashmapExists(expr2slot, (void*)expr->children[c]));
+
+         (*tape)->args[(*tape)->nargs] = SCIPhashmapGetImageInt(expr2slot, (void*)expr->children[c]);
+         (*tape)->argcoefs[(*tape)->nargs] = 1.0;
+         ++(*tape)->nargs;
+      }
+
+      switch( instr->opcode )
+      {
+         case SCIP_EXPRTAPE_OP_VAR :
+         {
+            SCIP_VAR* var = SCIPgetVarExprVar(expr);
+
+            if( !SCIPhashmapExists(var2idx, (void*)var) )
+            {
+               if( (*tape)->nvars == varssize )
+               {
+                  int newsize = SCIPsetCalcMemGrowSize(set, varssize + 1);
+                  SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->vars, varssize, newsize) );
+                  varssize = newsize;
+               }
+
+               SCIP_CALL( SCIPhashmapInsertInt(var2idx, (void*)var, (*tape)->nvars) );
+               (*tape)->vars[(*tape)->nvars] = var;
+               ++(*tape)->nvars;
+            }
+            instr->varidx = SCIPhashmapGetImageInt(var2idx, (void*)var);
+            break;
+         }
+
+         case SCIP_EXPRTAPE_OP_VALUE :
+            instr->coef = SCIPgetValueExprValue(expr);
+            break;
+
+         case SCIP_EXPRTAPE_OP_SUM :
+            instr->coef = SCIPgetConstantExprSum(expr);
+            for( c = 0; c < expr->nchildren; ++c )
+               (*tape)->argcoefs[instr->firstarg + c] = SCIPgetCoefsExprSum(expr)[c];
+            break;
+
+         case SCIP_EXPRTAPE_OP_PRODUCT :
+            instr->coef = SCIPgetCoefExprProduct(expr);
+            break;
+
+         case SCIP_EXPRTAPE_OP_POW :
+         case SCIP_EXPRTAPE_OP_SIGNPOWER :
+            instr->coef = SCIPgetExponentExprPow(expr);
+            break;
+
+         case SCIP_EXPRTAPE_OP_EXP :
+         case SCIP_EXPRTAPE_OP_LOG :
+         case SCIP_EXPRTAPE_OP_ABS :
+         case SCIP_EXPRTAPE_OP_GENERIC :
+            break;
+
+         default :
+            SCIPABORT();
+            break;
+      }
+
+      SCIP_CALL( SCIPhashmapInsertInt(expr2slot, (void*)expr, (*tape)->ninstrs) );
+      ++(*tape)->ninstrs;
+   }
+
+   SCIPexpriterFree(&it);
+   SCIPhashmapFree(&var2idx);
+   SCIPhashmapFree(&expr2slot);
+
+   assert((*tape)->ninstrs > 0);
+   assert((*tape)->instrs[(*tape)->ninstrs-1].expr == rootexpr);
+
+   /* shrink arrays to their final size */
+   SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->instrs, instrssize, (*tape)->ninstrs) );
+   SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->args, argssize, MAX((*tape)->nargs, 1)) );
+   SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->argcoefs, argssize, MAX((*tape)->nargs, 1)) );
+   SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*tape)->vars, varssize, MAX((*tape)->nvars, 1)) );
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->varvals, MAX((*tape)->nvars, 1)) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->slotvals, (*tape)->ninstrs) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->slotadjs, (*tape)->ninstrs) );
+
+   return SCIP_OKAY;
+}
+
+/** frees an expression evaluation tape and releases its root expression */
+SCIP_RETCODE SCIPexprtapeFree(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPRTAPE**       tape                /**< pointer to the tape to free */
+   )
+{
+   assert(tape != NULL);
+   assert(*tape != NULL);
+   assert((*tape)->blkmem == blkmem);
+
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->slotadjs, (*tape)->ninstrs);
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->slotvals, (*tape)->ninstrs);
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->varvals, MAX((*tape)->nvars, 1));
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->vars, MAX((*tape)->nvars, 1));
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->argcoefs, MAX((*tape)->nargs, 1));
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->args, MAX((*tape)->nargs, 1));
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->instrs, (*tape)->ninstrs);
+
+   SCIP_CALL( SCIPexprRelease(set, stat, blkmem, &(*tape)->root) );
+
+   BMSfreeBlockMemory(blkmem, tape);
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the expression of a tape for a given point
+ *
+ * Has the same effect as SCIPexprEval() on the root expression of the tape: the values of all subexpressions are
+ * stored in the expressions and the value of the root can be received via SCIPexprGetEvalValue(). If an error (domain
+ * error, ...) occurs, the value of the root is set to SCIP_INVALID.
+ */
+SCIP_RETCODE SCIPexprtapeEval(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   SCIP_Real* slotvals;
+   int i;
+
+   assert(set != NULL);
+   assert(tape != NULL);
+
+   /* if value is up-to-date, then nothing to do */
+   if( soltag != 0 && tape->root->evaltag == soltag )
+      return SCIP_OKAY;
+
+   if( tape->nvars > 0 )
+   {
+      SCIP_CALL( SCIPgetSolVals(set->scip, sol, tape->nvars, tape->vars, tape->varvals) );
+   }
+
+   slotvals = tape->slotvals;
+
+   for( i = 0; i < tape->ninstrs; ++i )
+   {
+      SCIP_EXPRTAPEINSTR* instr;
+      SCIP_Real val;
+      int a;
+
+      instr = &tape->instrs[i];
+
+      switch( instr->opcode )
+      {
+         case SCIP_EXPRTAPE_OP_VAR :
+            val = tape->varvals[instr->varidx];
+            break;
+
+         case SCIP_EXPRTAPE_OP_VALUE :
+            val = instr->coef;
+            break;
+
+         case SCIP_EXPRTAPE_OP_SUM :
+            val = instr->coef;
+            for( a = instr->firstarg; a < instr->firstarg + instr->nargs; ++a )
+               val += tape->argcoefs[a] * slotvals[tape->args[a]];
+            break;
+
+         case SCIP_EXPRTAPE_OP_PRODUCT :
+            val = instr->coef;
+            for( a = instr->firstarg; a < instr->firstarg + instr->nargs && val != 0.0; ++a )
+               val *= slotvals[tape->args[a]];
+            break;
+
+         case SCIP_EXPRTAPE_OP_POW :
+         case SCIP_EXPRTAPE_OP_SIGNPOWER :
+         case SCIP_EXPRTAPE_OP_EXP :
+         case SCIP_EXPRTAPE_OP_LOG :
+         case SCIP_EXPRTAPE_OP_ABS :
+            assert(instr->nargs == 1);
+            val = evalUnaryInstr(instr->opcode, instr->coef, slotvals[tape->args[instr->firstarg]]);
+            break;
+
+         case SCIP_EXPRTAPE_OP_GENERIC :
+            /* the values of the children have already been stored in the children */
+            SCIP_CALL( SCIPexprhdlrEvalExpr(instr->expr->exprhdlr, set, NULL, instr->expr, &val, NULL, sol) );
+            break;
+
+         default :
+            SCIPABORT();
+            val = SCIP_INVALID; /*lint !e527*/
+            break;
+      }
+
+      /* as in SCIPexprhdlrEvalExpr(), evaluation errors that have not been caught yet (e.g., overflow) make the
+       * value invalid
+       */
+      if( !SCIPisFinite(val) )
+         val = SCIP_INVALID;
+
+      slotvals[i] = val;
+      instr->expr->evalvalue = val;
+      instr->expr->evaltag = soltag;
+
+      if( val == SCIP_INVALID ) /*lint !e777*/
+      {
+         tape->root->evalvalue = SCIP_INVALID;
+         tape->root->evaltag = soltag;
+         break;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the gradient of the expression of a tape for a given point
+ *
+ * Has the same effect as SCIPexprEvalGradient() on the root expression of the tape. The partial derivatives can be
+ * received via SCIPexprGetDerivative() of the variable expressions. For the expressions that are shared within the
+ * DAG, the derivative stored is the partial derivative of the root w.r.t. this expression.
+ */
+SCIP_RETCODE SCIPexprtapeEvalGradient(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   SCIP_Real* slotvals;
+   SCIP_Real* slotadjs;
+   SCIP_Longint difftag;
+   int i;
+
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(tape != NULL);
+
+   /* ensure expression is evaluated; the slot values are only valid if the tape has been run for this point */
+   if( soltag == 0 || tape->root->evaltag != soltag )
+   {
+      SCIP_CALL( SCIPexprtapeEval(set, tape, sol, soltag) );
+   }
+   else
+   {
+      for( i = 0; i < tape->ninstrs; ++i )
+         tape->slotvals[i] = tape->instrs[i].expr->evalvalue;
+   }
+
+   /* check if expression could not be evaluated */
+   if( tape->root->evalvalue == SCIP_INVALID ) /*lint !e777*/
+   {
+      tape->root->derivative = SCIP_INVALID;
+      return SCIP_OKAY;
+   }
+
+   if( SCIPexprIsValue(set, tape->root) )
+   {
+      tape->root->derivative = 0.0;
+      return SCIP_OKAY;
+   }
+
+   difftag = ++(stat->exprlastdifftag);
+
+   slotvals = tape->slotvals;
+   slotadjs = tape->slotadjs;
+   BMSclearMemoryArray(slotadjs, tape->ninstrs);
+   slotadjs[tape->ninstrs - 1] = 1.0;
+
+   /* reverse sweep: when an instruction is reached, all of its parents have been processed */
+   for( i = tape->ninstrs - 1; i >= 0; --i )
+   {
+      SCIP_EXPRTAPEINSTR* instr;
+      SCIP_Real adj;
+      int a;
+
+      instr = &tape->instrs[i];
+      adj = slotadjs[i];
+
+      instr->expr->derivative = adj;
+      instr->expr->difftag = difftag;
+
+      for( a = 0; a < instr->nargs; ++a )
+      {
+         SCIP_Real derivative;
+         int argslot;
+
+         argslot = tape->args[instr->firstarg + a];
+
+         /* derivatives w.r.t. constants are not needed */
+         if( tape->instrs[argslot].opcode == SCIP_EXPRTAPE_OP_VALUE )
+            continue;
+
+         switch( instr->opcode )
+         {
+            case SCIP_EXPRTAPE_OP_SUM :
+               derivative = tape->argcoefs[instr->firstarg + a];
+               break;
+
+            case SCIP_EXPRTAPE_OP_PRODUCT :
+               if( !SCIPsetIsZero(set, slotvals[argslot]) )
+                  derivative = slotvals[i] / slotvals[argslot];
+               else
+               {
+                  int b;
+
+                  derivative = instr->coef;
+                  for( b = 0; b < instr->nargs && derivative != 0.0; ++b )
+                  {
+                     if( b != a )
+                        derivative *= slotvals[tape->args[instr->firstarg + b]];
+                  }
+               }
+               break;
+
+            case SCIP_EXPRTAPE_OP_POW :
+            case SCIP_EXPRTAPE_OP_SIGNPOWER :
+            case SCIP_EXPRTAPE_OP_EXP :
+            case SCIP_EXPRTAPE_OP_LOG :
+            case SCIP_EXPRTAPE_OP_ABS :
+               derivative = diffUnaryInstr(instr->opcode, instr->coef, slotvals[argslot], slotvals[i]);
+               break;
+
+            case SCIP_EXPRTAPE_OP_GENERIC :
+               derivative = SCIP_INVALID;
+               SCIP_CALL( SCIPexprhdlrBwDiffExpr(instr->expr->exprhdlr, set, NULL, instr->expr, a, &derivative, NULL, 0.0) );
+               break;
+
+            default :
+               SCIPABORT();
+               derivative = SCIP_INVALID; /*lint !e527*/
+               break;
+         }
+
+         if( derivative == SCIP_INVALID ) /*lint !e777*/
+         {
+            tape->root->derivative = SCIP_INVALID;
+            return SCIP_OKAY;
+         }
+
+         slotadjs[argslot] += adj * derivative;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the expression of a tape for many points at once
+ *
+ * The values of the variables are given in structure-of-arrays layout, that is, varvals[v * npoints + k] is the value
+ * of the v-th variable of the tape (see SCIPexprtapeGetVars()) in the k-th point. The loops of the instructions of
+ * the basic expression handlers run over all points, which allows the compiler to vectorize them. Expressions of other
+ * handlers are evaluated point by point with their evaluation callback.
+ *
+ * The values that are stored in the expressions are not changed. If the expression cannot be evaluated in a point,
+ * then SCIP_INVALID is stored for this point.
+ */
+SCIP_RETCODE SCIPexprtapeEvalBatch(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of the variables in all points (structure-of-arrays) */
+   SCIP_Real*            vals,               /**< array to store the values of the expression in all points */
+   SCIP_Real*            slotvals            /**< array of size ninstrs * npoints to store the values of all
+                                              *   instructions in all points, or NULL if not needed */
+   )
+{
+   SCIP_Bool* invalid;
+   SCIP_Real* batchvals;
+   SCIP_Real* childvals;
+   int maxnargs;
+   int i;
+   int k;
+
+   assert(set != NULL);
+   assert(tape != NULL);
+   assert(npoints >= 0);
+   assert(varvals != NULL || tape->nvars == 0 || npoints == 0);
+   assert(vals != NULL || npoints == 0);
+
+   if( npoints == 0 )
+      return SCIP_OKAY;
+
+   maxnargs = 1;
+   for( i = 0; i < tape->ninstrs; ++i )
+      maxnargs = MAX(maxnargs, tape->instrs[i].nargs);
+
+   if( slotvals != NULL )
+      batchvals = slotvals;
+   else
+   {
+      SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &batchvals, tape->ninstrs * npoints) );
+   }
+   SCIP_ALLOC( BMSallocClearBufferMemoryArray(bufmem, &invalid, npoints) );
+   SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &childvals, maxnargs) );
+
+   for( i = 0; i < tape->ninstrs; ++i )
+   {
+      SCIP_EXPRTAPEINSTR* instr;
+      SCIP_Real* out;
+      int a;
+
+      instr = &tape->instrs[i];
+      out = &batchvals[i * npoints];
+
+      switch( instr->opcode )
+      {
+         case SCIP_EXPRTAPE_OP_VAR :
+            BMScopyMemoryArray(out, &varvals[instr->varidx * npoints], npoints);  /*lint !e866*/
+            break;
+
+         case SCIP_EXPRTAPE_OP_VALUE :
+            for( k = 0; k < npoints; ++k )
+               out[k] = instr->coef;
+            break;
+
+         case SCIP_EXPRTAPE_OP_SUM :
+            for( k = 0; k < npoints; ++k )
+               out[k] = instr->coef;
+            for( a = instr->firstarg; a < instr->firstarg + instr->nargs; ++a )
+            {
+               const SCIP_Real* in = &batchvals[tape->args[a] * npoints];
+               SCIP_Real coef = tape->argcoefs[a];
+
+               for( k = 0; k < npoints; ++k )
+                  out[k] += coef * in[k];
+            }
+            break;
+
+         case SCIP_EXPRTAPE_OP_PRODUCT :
+            for( k = 0; k < npoints; ++k )
+               out[k] = instr->coef;
+            for( a = instr->firstarg; a < instr->firstarg + instr->nargs; ++a )
+            {
+               const SCIP_Real* in = &batchvals[tape->args[a] * npoints];
+
+               for( k = 0; k < npoints; ++k )
+                  out[k] *= in[k];
+            }
+            break;
+
+         case SCIP_EXPRTAPE_OP_POW :
+         case SCIP_EXPRTAPE_OP_SIGNPOWER :
+         case SCIP_EXPRTAPE_OP_LOG :
+         {
+            const SCIP_Real* in = &batchvals[tape->args[instr->firstarg] * npoints];
+
+            for( k = 0; k < npoints; ++k )
+               out[k] = evalUnaryInstr(instr->opcode, instr->coef, in[k]);
+            break;
+         }
+
+         case SCIP_EXPRTAPE_OP_EXP :
+         {
+            const SCIP_Real* in = &batchvals[tape->args[instr->firstarg] * npoints];
+
+            for( k = 0; k < npoints; ++k )
+               out[k] = exp(in[k]);
+            break;
+         }
+
+         case SCIP_EXPRTAPE_OP_ABS :
+         {
+            const SCIP_Real* in = &batchvals[tape->args[instr->firstarg] * npoints];
+
+            for( k = 0; k < npoints; ++k )
+               out[k] = REALABS(in[k]);
+            break;
+         }
+
+         case SCIP_EXPRTAPE_OP_GENERIC :
+            for( k = 0; k < npoints; ++k )
+            {
+               /* points with evaluation errors are not passed to the expression handler, but the value of the
+                * instruction has to be set, since it is read by later instructions
+                */
+               if( invalid[k] )
+               {
+                  out[k] = SCIP_INVALID;
+                  continue;
+               }
+
+               for( a = 0; a < instr->nargs; ++a )
+                  childvals[a] = batchvals[tape->args[instr->firstarg + a] * npoints + k];
+
+               SCIP_CALL( SCIPexprhdlrEvalExpr(instr->expr->exprhdlr, set, bufmem, instr->expr, &out[k], childvals, NULL) );
+            }
+            break;
+
+         default :
+            SCIPABORT();
+            break;
+      }
+
+      /* mark points with evaluation errors; the values that later instructions compute for marked points are
+       * meaningless but always initialized, and they do not affect the values in the other points
+       */
+      for( k = 0; k < npoints; ++k )
+      {
+         if( out[k] == SCIP_INVALID || !SCIPisFinite(out[k]) ) /*lint !e777*/
+            invalid[k] = TRUE;
+      }
+   }
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = invalid[k] ? SCIP_INVALID : batchvals[(tape->ninstrs - 1) * npoints + k];
+
+   BMSfreeBufferMemoryArray(bufmem, &childvals);
+   BMSfreeBufferMemoryArray(bufmem, &invalid);
+   if( slotvals == NULL )
+   {
+      BMSfreeBufferMemoryArray(bufmem, &batchvals);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the gradient of the expression of a tape for many points at once
+ *
+ * Requires the values of all instructions in all points, as computed by SCIPexprtapeEvalBatch() in slotvals, and the
+ * values of the expression in vals. The partial derivatives are stored in structure-of-arrays layout, that is,
+ * grads[v * npoints + k] is the partial derivative w.r.t. the v-th variable of the tape in the k-th point. If the
+ * expression or its gradient cannot be evaluated in a point, then SCIP_INVALID is stored for all partial derivatives
+ * in this point. The derivatives that are stored in the expressions are not changed.
+ */
+SCIP_RETCODE SCIPexprtapeEvalBatchGradient(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            slotvals,           /**< values of all instructions in all points, see SCIPexprtapeEvalBatch() */
+   SCIP_Real*            vals,               /**< values of the expression in all points */
+   SCIP_Real*            grads               /**< array of size nvars * npoints to store the gradients in all points */
+   )
+{
+   SCIP_Bool* invalid;
+   SCIP_Real* adjs;
+   SCIP_Real* childvals;
+   int maxnargs;
+   int i;
+   int k;
+
+   assert(set != NULL);
+   assert(tape != NULL);
+   assert(npoints >= 0);
+   assert(slotvals != NULL || npoints == 0);
+   assert(vals != NULL || npoints == 0);
+   assert(grads != NULL || tape->nvars == 0 || npoints == 0);
+
+   if( npoints == 0 || tape->nvars == 0 )
+      return SCIP_OKAY;
+
+   maxnargs = 1;
+   for( i = 0; i < tape->ninstrs; ++i )
+      maxnargs = MAX(maxnargs, tape->instrs[i].nargs);
+
+   SCIP_ALLOC( BMSallocClearBufferMemoryArray(bufmem, &adjs, tape->ninstrs * npoints) );
+   SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &invalid, npoints) );
+   SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &childvals, maxnargs) );
+
+   BMSclearMemoryArray(grads, tape->nvars * npoints);
+
+   for( k = 0; k < npoints; ++k )
+   {
+      invalid[k] = (vals[k] == SCIP_INVALID); /*lint !e777*/
+      adjs[(tape->ninstrs - 1) * npoints + k] = 1.0;
+   }
+
+   /* reverse sweep over all points: when an instruction is reached, all of its parents have been processed */
+   for( i = tape->ninstrs - 1; i >= 0; --i )
+   {
+      SCIP_EXPRTAPEINSTR* instr;
+      const SCIP_Real* adj;
+      const SCIP_Real* val;
+      int a;
+
+      instr = &tape->instrs[i];
+      adj = &adjs[i * npoints];
+      val = &slotvals[i * npoints];
+
+      if( instr->opcode == SCIP_EXPRTAPE_OP_VAR )
+      {
+         SCIP_Real* grad = &grads[instr->varidx * npoints];
+
+         for( k = 0; k < npoints; ++k )
+            grad[k] += adj[k];
+         continue;
+      }
+
+      for( a = 0; a < instr->nargs; ++a )
+      {
+         const SCIP_Real* argval;
+         SCIP_Real* argadj;
+         int argslot;
+
+         argslot = tape->args[instr->firstarg + a];
+
+         /* derivatives w.r.t. constants are not needed */
+         if( tape->instrs[argslot].opcode == SCIP_EXPRTAPE_OP_VALUE )
+            continue;
+
+         argval = &slotvals[argslot * npoints];
+         argadj = &adjs[argslot * npoints];
+
+         switch( instr->opcode )
+         {
+            case SCIP_EXPRTAPE_OP_SUM :
+            {
+               SCIP_Real coef = tape->argcoefs[instr->firstarg + a];
+
+               for( k = 0; k < npoints; ++k )
+                  argadj[k] += coef * adj[k];
+               break;
+            }
+
+            case SCIP_EXPRTAPE_OP_PRODUCT :
+               for( k = 0; k < npoints; ++k )
+               {
+                  SCIP_Real derivative;
+
+                  if( !SCIPsetIsZero(set, argval[k]) )
+                     derivative = val[k] / argval[k];
+                  else
+                  {
+                     int b;
+
+                     derivative = instr->coef;
+                     for( b = 0; b < instr->nargs && derivative != 0.0; ++b )
+                     {
+                        if( b != a )
+                           derivative *= slotvals[tape->args[instr->firstarg + b] * npoints + k];
+                     }
+                  }
+                  argadj[k] += adj[k] * derivative;
+               }
+               break;
+
+            case SCIP_EXPRTAPE_OP_EXP :
+               for( k = 0; k < npoints; ++k )
+                  argadj[k] += adj[k] * val[k];
+               break;
+
+            case SCIP_EXPRTAPE_OP_POW :
+            case SCIP_EXPRTAPE_OP_SIGNPOWER :
+            case SCIP_EXPRTAPE_OP_LOG :
+            case SCIP_EXPRTAPE_OP_ABS :
+               for( k = 0; k < npoints; ++k )
+               {
+                  SCIP_Real derivative;
+
+                  derivative = diffUnaryInstr(instr->opcode, instr->coef, argval[k], val[k]);
+                  if( derivative == SCIP_INVALID ) /*lint !e777*/
+                     invalid[k] = TRUE;
+                  else
+                     argadj[k] += adj[k] * derivative;
+               }
+               break;
+
+            case SCIP_EXPRTAPE_OP_GENERIC :
+               for( k = 0; k < npoints; ++k )
+               {
+                  SCIP_Real derivative;
+                  int b;
+
+                  if( invalid[k] )
+                     continue;
+
+                  for( b = 0; b < instr->nargs; ++b )
+                     childvals[b] = slotvals[tape->args[instr->firstarg + b] * npoints + k];
+
+                  derivative = SCIP_INVALID;
+                  SCIP_CALL( SCIPexprhdlrBwDiffExpr(instr->expr->exprhdlr, set, bufmem, instr->expr, a, &derivative,
+                        childvals, val[k]) );
+
+                  if( derivative == SCIP_INVALID ) /*lint !e777*/
+                     invalid[k] = TRUE;
+                  else
+                     argadj[k] += adj[k] * derivative;
+               }
+               break;
+
+            default :
+               SCIPABORT();
+               break;
+         }
+      }
+   }
+
+   /* invalidate gradients of points where the expression or its gradient could not be evaluated */
+   for( k = 0; k < npoints; ++k )
+   {
+      int v;
+
+      if( !invalid[k] )
+         continue;
+
+      for( v = 0; v < tape->nvars; ++v )
+         grads[v * npoints + k] = SCIP_INVALID;
+   }
+
+   BMSfreeBufferMemoryArray(bufmem, &childvals);
+   BMSfreeBufferMemoryArray(bufmem, &invalid);
+   BMSfreeBufferMemoryArray(bufmem, &adjs);
+
+   return SCIP_OKAY;
+}
+
+/** gives the root expression of an expression evaluation tape */
+SCIP_EXPR* SCIPexprtapeGetRoot(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   )
+{
+   assert(tape != NULL);
+
+   return tape->root;
+}
+
+/** gives the number of distinct variables of an expression evaluation tape */
+int SCIPexprtapeGetNVars(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   )
+{
+   assert(tape != NULL);
+
+   return tape->nvars;
+}
+
+/** gives the distinct variables of an expression evaluation tape, in the order that is used for batch evaluation */
+SCIP_VAR** SCIPexprtapeGetVars(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   )
+{
+   assert(tape != NULL);
+
+   return tape->vars;
+}
+
+/** gives the number of instructions of an expression evaluation tape */
+int SCIPexprtapeGetNInstrs(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   )
+{
+   assert(tape != NULL);
+
+   return tape->ninstrs;
+}
@@ -104,6 +104,8 @@ struct SCIP_HeurData
    SCIP_Real             gradlimit;          /**< limit for gradient computations for all improvePoint() calls (0 for no limit) */
    int                   maxncluster;        /**< maximum number of considered clusters per heuristic call */
    SCIP_Bool             onlynlps;           /**< should the heuristic run only on continuous problems? */
+
+   SCIP_HASHMAP*         nlrowtapes;         /**< evaluation tapes of the expressions of the nlrows, or NULL */
 };
 
 
@@ -245,6 +247,209 @@ SCIP_RETCODE getMinFeas(
    return SCIP_OKAY;
 }
 
+/** gives the evaluation tape of the expression of a nonlinear row
+ *
+ * The tapes are kept in the heuristic data for all calls of the heuristic during the solving process. A tape is
+ * compiled again if the expression of the row has been replaced since the tape was created.
+ */
+static
+SCIP_RETCODE getNlRowTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data */
+   SCIP_NLROW*           nlrow,              /**< nonlinear row with an expression */
+   SCIP_EXPRTAPE**       tape                /**< buffer to store the evaluation tape */
+   )
+{
+   assert(heurdata != NULL);
+   assert(nlrow != NULL);
+   assert(SCIPnlrowGetExpr(nlrow) != NULL);
+   assert(tape != NULL);
+   assert(heurdata->nlrowtapes != NULL);
+
+   *tape = (SCIP_EXPRTAPE*)SCIPhashmapGetImage(heurdata->nlrowtapes, (void*)nlrow);
+
+   if( *tape != NULL && SCIPexprtapeGetRoot(*tape) != SCIPnlrowGetExpr(nlrow) )
+   {
+      SCIP_CALL( SCIPfreeExprTape(scip, tape) );
+   }
+
+   if( *tape == NULL )
+   {
+      SCIP_CALL( SCIPcreateExprTape(scip, tape, SCIPnlrowGetExpr(nlrow)) );
+      SCIP_CALL( SCIPhashmapSetImage(heurdata->nlrowtapes, (void*)nlrow, (void*)*tape) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the evaluation tapes of the nonlinear rows */
+static
+SCIP_RETCODE freeNlRowTapes(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata            /**< heuristic data */
+   )
+{
+   int i;
+
+   assert(heurdata != NULL);
+
+   if( heurdata->nlrowtapes == NULL )
+      return SCIP_OKAY;
+
+   for( i = 0; i < SCIPhashmapGetNEntries(heurdata->nlrowtapes); ++i )
+   {
+      SCIP_HASHMAPENTRY* entry;
+      SCIP_EXPRTAPE* tape;
+
+      entry = SCIPhashmapGetEntry(heurdata->nlrowtapes, i);
+      if( entry == NULL )
+         continue;
+
+      tape = (SCIP_EXPRTAPE*)SCIPhashmapEntryGetImage(entry);
+      SCIP_CALL( SCIPfreeExprTape(scip, &tape) );
+   }
+
+   SCIPhashmapFree(&heurdata->nlrowtapes);
+
+   return SCIP_OKAY;
+}
+
+/** computes the minimum feasibilities of many points at once; a negative value means that there is an infeasibility
+ *
+ * The expressions of the rows are evaluated in all points at once, see SCIPevalExprTapeBatch(). The activities are
+ * computed as in SCIPgetNlRowSolActivity(); in particular, the activity of a row is SCIP_INVALID in points in which one
+ * of its variables has value SCIP_UNKNOWN.
+ */
+static
+SCIP_RETCODE getMinFeasBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data */
+   SCIP_NLROW**          nlrows,             /**< array containing all nlrows */
+   int                   nnlrows,            /**< total number of nlrows */
+   SCIP_SOL**            sols,               /**< solutions */
+   int                   nsols,              /**< number of solutions */
+   SCIP_Real*            minfeas             /**< array to store the minimum feasibility of each solution */
+   )
+{
+   SCIP_Bool* unknown;
+   SCIP_Real* exprvals;
+   SCIP_Real* varvals;
+   int varvalssize;
+   int i;
+   int k;
+
+   assert(scip != NULL);
+   assert(heurdata != NULL);
+   assert(sols != NULL);
+   assert(nsols > 0);
+   assert(minfeas != NULL);
+   assert(nlrows != NULL);
+   assert(nnlrows > 0);
+
+   varvalssize = nsols;
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprvals, nsols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &unknown, nsols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varvals, varvalssize) );
+
+   if( heurdata->nlrowtapes == NULL )
+   {
+      SCIP_CALL( SCIPhashmapCreate(&heurdata->nlrowtapes, SCIPblkmem(scip), nnlrows) );
+   }
+
+   for( k = 0; k < nsols; ++k )
+      minfeas[k] = SCIPinfinity(scip);
+
+   for( i = 0; i < nnlrows; ++i )
+   {
+      SCIP_NLROW* nlrow = nlrows[i];
+      int j;
+
+      assert(nlrow != NULL);
+
+      for( k = 0; k < nsols; ++k )
+         unknown[k] = FALSE;
+
+      if( SCIPnlrowGetExpr(nlrow) != NULL )
+      {
+         SCIP_EXPRTAPE* tape;
+         SCIP_VAR** tapevars;
+         int ntapevars;
+
+         SCIP_CALL( getNlRowTape(scip, heurdata, nlrow, &tape) );
+
+         tapevars = SCIPexprtapeGetVars(tape);
+         ntapevars = SCIPexprtapeGetNVars(tape);
+
+         if( ntapevars * nsols > varvalssize )
+         {
+            varvalssize = SCIPcalcMemGrowSize(scip, ntapevars * nsols);
+            SCIP_CALL( SCIPreallocBufferArray(scip, &varvals, varvalssize) );
+         }
+
+         /* collect the values of the variables of the expression in structure-of-arrays layout */
+         for( j = 0; j < ntapevars; ++j )
+         {
+            for( k = 0; k < nsols; ++k )
+            {
+               SCIP_Real val = SCIPgetSolVal(scip, sols[k], tapevars[j]);
+
+               if( val == SCIP_UNKNOWN ) /*lint !e777*/
+               {
+                  unknown[k] = TRUE;
+                  val = 0.0;
+               }
+               varvals[j * nsols + k] = val;
+            }
+         }
+
+         SCIP_CALL( SCIPevalExprTapeBatch(scip, tape, nsols, varvals, exprvals) );
+      }
+
+      for( k = 0; k < nsols; ++k )
+      {
+         SCIP_Real activity;
+         SCIP_Real feasibility;
+
+         /* compute activity as in SCIPgetNlRowSolActivity() */
+         activity = SCIPnlrowGetConstant(nlrow);
+         for( j = 0; j < SCIPnlrowGetNLinearVars(nlrow) && !unknown[k]; ++j )
+         {
+            SCIP_Real val = SCIPgetSolVal(scip, sols[k], SCIPnlrowGetLinearVars(nlrow)[j]);
+
+            if( val == SCIP_UNKNOWN ) /*lint !e777*/
+               unknown[k] = TRUE;
+            else
+               activity += SCIPnlrowGetLinearCoefs(nlrow)[j] * val;
+         }
+
+         if( unknown[k] )
+            activity = SCIP_INVALID;
+         else
+         {
+            if( SCIPnlrowGetExpr(nlrow) != NULL )
+            {
+               if( exprvals[k] == SCIP_INVALID ) /*lint !e777*/
+                  activity = SCIP_INVALID;
+               else
+                  activity += exprvals[k];
+            }
+
+            activity = MAX(activity, -SCIPinfinity(scip)); /*lint !e666*/
+            activity = MIN(activity, SCIPinfinity(scip)); /*lint !e666*/
+         }
+
+         feasibility = MIN(SCIPnlrowGetRhs(nlrow) - activity, activity - SCIPnlrowGetLhs(nlrow));
+         minfeas[k] = MIN(minfeas[k], feasibility);
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &varvals);
+   SCIPfreeBufferArray(scip, &unknown);
+   SCIPfreeBufferArray(scip, &exprvals);
+
+   return SCIP_OKAY;
+}
+
 /** computes the gradient for a given point and nonlinear row */
 static
 SCIP_RETCODE computeGradient(
@@ -322,7 +527,8 @@ SCIP_RETCODE improvePoint(
    int                   maxiter,            /**< maximum number of iterations */
    SCIP_Real             minimprfac,         /**< minimum required improving factor to proceed in the improvement of a single point */
    int                   minimpriter,        /**< number of iteration when checking the minimum improvement */
-   SCIP_Real*            minfeas,            /**< pointer to store the minimum feasibility */
+   SCIP_Real*            minfeas,            /**< pointer to the minimum feasibility of the start point, which is
+                                              *   updated to the minimum feasibility of the improved point */
    SCIP_Real*            nlrowgradcosts,     /**< estimated costs for each gradient computation */
    SCIP_Real*            gradcosts           /**< pointer to store the estimated gradient costs */
    )
@@ -347,7 +553,6 @@ SCIP_RETCODE improvePoint(
 
    *gradcosts = 0.0;
 
-   SCIP_CALL( getMinFeas(scip, nlrows, nnlrows, point, minfeas) );
 #ifdef SCIP_DEBUG_IMPROVEPOINT
    printf("start minfeas = %e\n", *minfeas);
 #endif
@@ -819,8 +1024,10 @@ SCIP_RETCODE applyHeur(
       goto TERMINATE;
 
    /*
-    * 2. improve points via consensus vectors
+    * 2. improve points via consensus vectors; the feasibilities of all start points are computed at once
     */
+   SCIP_CALL( getMinFeasBatch(scip, heurdata, nlrows, nnlrows, points, nrndpoints, feasibilities) );
+
    gradlimit = heurdata->gradlimit == 0.0 ? SCIPinfinity(scip) : heurdata->gradlimit;
    for( npoints = 0; npoints < nrndpoints && gradlimit >= 0 && !SCIPisStopped(scip); ++npoints )
    {
@@ -966,6 +1173,23 @@ SCIP_DECL_HEUREXIT(heurExitMultistart)
    return SCIP_OKAY;
 }
 
+/** solving process deinitialization method of primal heuristic (called before branch and bound process data is freed) */
+static
+SCIP_DECL_HEUREXITSOL(heurExitsolMultistart)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert( heur != NULL );
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   /* the tapes are specific to the nlrows of the current solving process */
+   SCIP_CALL( freeNlRowTapes(scip, heurdata) );
+
+   return SCIP_OKAY;
+}
+
 /** execution method of primal heuristic */
 static
 SCIP_DECL_HEUREXEC(heurExecMultistart)
@@ -1022,6 +1246,7 @@ SCIP_RETCODE SCIPincludeHeurMultistart(
    SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeMultistart) );
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitMultistart) );
    SCIP_CALL( SCIPsetHeurExit(scip, heur, heurExitMultistart) );
+   SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolMultistart) );
 
    /* add multistart primal heuristic parameters */
    SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nrndpoints",
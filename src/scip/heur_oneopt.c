@@ -32,6 +32,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/heur_oneopt.h"
+#include "scip/heuristics.h"
 #include "scip/pub_heur.h"
 #include "scip/pub_lp.h"
 #include "scip/pub_message.h"
@@ -207,55 +208,6 @@ SCIP_Real calcShiftVal(
 }
 
 
-/** update row activities after a variable's solution value changed */
-static
-SCIP_RETCODE updateRowActivities(
-   SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_Real*            activities,         /**< LP row activities */
-   SCIP_VAR*             var,                /**< variable that has been changed */
-   SCIP_Real             shiftval            /**< value that is added to variable */
-   )
-{
-   SCIP_Real* colvals;
-   SCIP_ROW** colrows;
-   SCIP_COL* col;
-
-   int ncolrows;
-
-   assert(activities != NULL);
-
-   /* get data of column associated to variable */
-   col = SCIPvarGetCol(var);
-   colrows = SCIPcolGetRows(col);
-   colvals = SCIPcolGetVals(col);
-   ncolrows = SCIPcolGetNLPNonz(col);
-   assert(ncolrows == 0 || (colrows != NULL && colvals != NULL));
-
-   /* enumerate all rows with nonzero entry in this column */
-   for( int i = 0; i < ncolrows; ++i )
-   {
-      SCIP_ROW* row;
-      int rowpos;
-
-      row = colrows[i];
-      rowpos = SCIProwGetLPPos(row);
-      assert(-1 <= rowpos && rowpos < SCIPgetNLPRows(scip) );
-
-      /* update row activity, only regard global rows in the LP */
-      if( rowpos >= 0 && !SCIProwIsLocal(row) )
-      {
-         activities[rowpos] +=  shiftval * colvals[i];
-
-         if( SCIPisInfinity(scip, activities[rowpos]) )
-            activities[rowpos] = SCIPinfinity(scip);
-         else if( SCIPisInfinity(scip, -activities[rowpos]) )
-            activities[rowpos] = -SCIPinfinity(scip);
-      }
-   }
-
-   return SCIP_OKAY;
-}
-
 /** setup and solve oneopt sub-SCIP */
 static
 SCIP_RETCODE setupAndSolveSubscipOneopt(
@@ -475,7 +427,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
    SCIP_SOL* worksol;                        /* heuristic's working solution         */
    SCIP_VAR** vars;                          /* SCIP variables                       */
    SCIP_VAR** shiftcands;                    /* shiftable variables                  */
-   SCIP_ROW** lprows;                        /* SCIP LP rows                         */
+   SCIP_CHECKEDSOL* checkedsol;              /* working solution with LP row activities */
    SCIP_Real* activities;                    /* row activities for working solution  */
    SCIP_Real* shiftvals;
    SCIP_Bool shifted;
@@ -489,7 +441,6 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
    int nbinvars;
    int nintvars;
    int nvars;
-   int nlprows;
    int nshiftcands;
    int shiftcandssize;
    int nsuccessfulshifts;
@@ -626,39 +577,18 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
 
    SCIPdebugMsg(scip, "number of bound changes (due to global bounds) = %d\n", nchgbound);
 
-   SCIP_CALL( SCIPgetLPRowsData(scip, &lprows, &nlprows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &activities, nlprows) );
-
-   valid = TRUE;
-
-   /* initialize LP row activities */
-   for( int i = 0; i < nlprows; ++i )
-   {
-      SCIP_ROW* row;
-
-      row = lprows[i];
-      assert(SCIProwGetLPPos(row) == i);
+   /* initialize LP row activities; they are updated with every shift of the working solution */
+   SCIP_CALL( SCIPcreateCheckedSol(scip, &checkedsol, worksol) );
+   activities = SCIPgetCheckedSolRowActivities(checkedsol);
 
-      if( !SCIProwIsLocal(row) )
-      {
-         activities[i] = SCIPgetRowSolActivity(scip, row, worksol);
-         SCIPdebugMsg(scip, "Row <%s> has activity %g\n", SCIProwGetName(row), activities[i]);
-         if( SCIPisFeasLT(scip, activities[i], SCIProwGetLhs(row)) || SCIPisFeasGT(scip, activities[i], SCIProwGetRhs(row)) )
-         {
-            valid = FALSE;
-            SCIPdebug( SCIP_CALL( SCIPprintRow(scip, row, NULL) ) );
-            SCIPdebugMsg(scip, "row <%s> activity %g violates bounds, lhs = %g, rhs = %g\n", SCIProwGetName(row), activities[i], SCIProwGetLhs(row), SCIProwGetRhs(row));
-            break;
-         }
-      }
-   }
+   valid = (SCIPgetCheckedSolNViolRows(checkedsol) == 0);
 
    if( !valid )
    {
       /** @todo try to correct lp rows */
       SCIPdebugMsg(scip, "Some global bound changes were not valid in lp rows.\n");
 
-      SCIPfreeBufferArray(scip, &activities);
+      SCIPfreeCheckedSol(scip, &checkedsol);
       SCIP_CALL( SCIPfreeSol(scip, &worksol) );
 
       return SCIP_OKAY;
@@ -728,8 +658,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
             assert(!SCIPisFeasZero(scip,shiftval));
             SCIPdebugMsg(scip, " Only one shiftcand found, var <%s>, which is now shifted by<%1.1f> \n",
                SCIPvarGetName(var), shiftval);
-            SCIP_CALL( SCIPsetSolVal(scip, worksol, var, solval+shiftval) );
-            SCIP_CALL( updateRowActivities(scip, activities, var, shiftval) );
+            SCIP_CALL( SCIPsetCheckedSolVal(scip, checkedsol, var, solval+shiftval) );
             ++nsuccessfulshifts;
          }
          else
@@ -769,8 +698,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
                if( ! SCIPisFeasZero(scip, shiftval) )
                {
                   SCIPdebugMsg(scip, " -> Variable <%s> is now shifted by <%1.1f> \n", SCIPvarGetName(vars[i]), shiftval);
-                  SCIP_CALL( SCIPsetSolVal(scip, worksol, var, solval+shiftval) );
-                  SCIP_CALL( updateRowActivities(scip, activities, var, shiftval) );
+                  SCIP_CALL( SCIPsetCheckedSolVal(scip, checkedsol, var, solval+shiftval) );
                   ++nsuccessfulshifts;
                }
             }
@@ -791,10 +719,10 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
       {
          SCIP_Bool success;
 
-         /* since activities are maintained iteratively, we cannot guarantee the feasibility of the shiftings and have
-          * to set the checklprows flag to TRUE
+         /* the activities of the shifted rows are recomputed before the check, so that the LP rows need not be checked
+          * again by the constraint handlers
           */
-         SCIP_CALL( SCIPtrySol(scip, worksol, FALSE, FALSE, FALSE, FALSE, TRUE, &success) );
+         SCIP_CALL( SCIPtryCheckedSol(scip, checkedsol, FALSE, FALSE, FALSE, FALSE, &success) );
 
          if( success )
          {
@@ -887,7 +815,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
 
    SCIPfreeBufferArray(scip, &shiftvals);
    SCIPfreeBufferArray(scip, &shiftcands);
-   SCIPfreeBufferArray(scip, &activities);
+   SCIPfreeCheckedSol(scip, &checkedsol);
 
    SCIP_CALL( SCIPfreeSol(scip, &worksol) );
 
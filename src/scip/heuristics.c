@@ -32,6 +32,7 @@
 #include "scip/cons_linear.h"
 #include "scip/scipdefplugins.h"
 #include "scip/stat.h"
+#include "scip/struct_heur.h"
 #include "scip/struct_scip.h"
 
 #include "scip/pub_heur.h"
@@ -1107,3 +1108,262 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
 
    return SCIP_OKAY;
 }
+
+/** returns whether the activity of an LP row violates one of its sides */
+static
+SCIP_Bool isRowViolated(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW*             row,                /**< LP row */
+   SCIP_Real             activity            /**< activity of the row */
+   )
+{
+   return SCIPisFeasLT(scip, activity, SCIProwGetLhs(row)) || SCIPisFeasGT(scip, activity, SCIProwGetRhs(row));
+}
+
+/** updates the violation status of an LP row of a checked solution */
+static
+void checkedsolUpdateViolation(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL*      checkedsol,         /**< checked solution */
+   SCIP_ROW*             row,                /**< LP row */
+   int                   rowpos              /**< LP position of the row */
+   )
+{
+   SCIP_Bool violated;
+
+   violated = isRowViolated(scip, row, checkedsol->activities[rowpos]);
+
+   if( violated != checkedsol->violated[rowpos] )
+   {
+      if( SCIProwIsLocal(row) )
+         checkedsol->nviollocalrows += (violated ? 1 : -1);
+      else
+         checkedsol->nviolrows += (violated ? 1 : -1);
+      checkedsol->violated[rowpos] = violated;
+   }
+   assert(checkedsol->nviolrows >= 0);
+   assert(checkedsol->nviollocalrows >= 0);
+}
+
+/** creates a checked solution that updates the activities of the LP rows when values of the working solution are
+ *  changed via SCIPsetCheckedSolVal()
+ *
+ *  The working solution has to be a transformed solution and the LP rows may not change while the checked solution is
+ *  in use.
+ */
+SCIP_RETCODE SCIPcreateCheckedSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL**     checkedsol,         /**< pointer to store the checked solution */
+   SCIP_SOL*             sol                 /**< working solution, which is not copied */
+   )
+{
+   SCIP_ROW** lprows;
+   int nlprows;
+   int r;
+
+   assert(scip != NULL);
+   assert(checkedsol != NULL);
+   assert(sol != NULL);
+   assert(!SCIPsolIsOriginal(sol));
+
+   SCIP_CALL( SCIPgetLPRowsData(scip, &lprows, &nlprows) );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, checkedsol) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*checkedsol)->activities, nlprows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*checkedsol)->violated, nlprows) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &(*checkedsol)->changed, nlprows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*checkedsol)->changedrows, nlprows) );
+   (*checkedsol)->sol = sol;
+   (*checkedsol)->nchangedrows = 0;
+   (*checkedsol)->nviolrows = 0;
+   (*checkedsol)->nviollocalrows = 0;
+   (*checkedsol)->nlprows = nlprows;
+
+   for( r = 0; r < nlprows; ++r )
+   {
+      assert(SCIProwGetLPPos(lprows[r]) == r);
+
+      (*checkedsol)->violated[r] = FALSE;
+      (*checkedsol)->activities[r] = SCIPgetRowSolActivity(scip, lprows[r], sol);
+      checkedsolUpdateViolation(scip, *checkedsol, lprows[r], r);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees a checked solution; the working solution is not freed */
+void SCIPfreeCheckedSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL**     checkedsol          /**< pointer to the checked solution */
+   )
+{
+   int nlprows;
+
+   assert(scip != NULL);
+   assert(checkedsol != NULL);
+   assert(*checkedsol != NULL);
+
+   nlprows = (*checkedsol)->nlprows;
+
+   SCIPfreeBlockMemoryArray(scip, &(*checkedsol)->changedrows, nlprows);
+   SCIPfreeBlockMemoryArray(scip, &(*checkedsol)->changed, nlprows);
+   SCIPfreeBlockMemoryArray(scip, &(*checkedsol)->violated, nlprows);
+   SCIPfreeBlockMemoryArray(scip, &(*checkedsol)->activities, nlprows);
+   SCIPfreeBlockMemory(scip, checkedsol);
+}
+
+/** sets the value of an active variable in the working solution and updates the activities of the LP rows of its column
+ *  in time linear in the column length
+ */
+SCIP_RETCODE SCIPsetCheckedSolVal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL*      checkedsol,         /**< checked solution */
+   SCIP_VAR*             var,                /**< active variable to set the value for */
+   SCIP_Real             val                 /**< new value of the variable */
+   )
+{
+   SCIP_ROW** colrows;
+   SCIP_Real* colvals;
+   SCIP_COL* col;
+   SCIP_Real delta;
+   int ncolrows;
+   int i;
+
+   assert(scip != NULL);
+   assert(checkedsol != NULL);
+   assert(var != NULL);
+   assert(SCIPvarIsActive(var));
+   assert(SCIPgetNLPRows(scip) == checkedsol->nlprows);
+
+   delta = val - SCIPgetSolVal(scip, checkedsol->sol, var);
+
+   SCIP_CALL( SCIPsetSolVal(scip, checkedsol->sol, var, val) );
+
+   /* loose variables do not appear in LP rows */
+   if( delta == 0.0 || SCIPvarGetStatus(var) != SCIP_VARSTATUS_COLUMN ) /*lint !e777*/
+      return SCIP_OKAY;
+
+   col = SCIPvarGetCol(var);
+   colrows = SCIPcolGetRows(col);
+   colvals = SCIPcolGetVals(col);
+   ncolrows = SCIPcolGetNLPNonz(col);
+   assert(ncolrows == 0 || (colrows != NULL && colvals != NULL));
+
+   for( i = 0; i < ncolrows; ++i )
+   {
+      SCIP_ROW* row;
+      int rowpos;
+
+      row = colrows[i];
+      rowpos = SCIProwGetLPPos(row);
+      assert(-1 <= rowpos && rowpos < checkedsol->nlprows);
+
+      if( rowpos < 0 )
+         continue;
+
+      checkedsol->activities[rowpos] += delta * colvals[i];
+
+      if( SCIPisInfinity(scip, checkedsol->activities[rowpos]) )
+         checkedsol->activities[rowpos] = SCIPinfinity(scip);
+      else if( SCIPisInfinity(scip, -checkedsol->activities[rowpos]) )
+         checkedsol->activities[rowpos] = -SCIPinfinity(scip);
+
+      checkedsolUpdateViolation(scip, checkedsol, row, rowpos);
+
+      if( !checkedsol->changed[rowpos] )
+      {
+         checkedsol->changed[rowpos] = TRUE;
+         checkedsol->changedrows[checkedsol->nchangedrows++] = rowpos;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the number of global LP rows that are violated by the working solution */
+int SCIPgetCheckedSolNViolRows(
+   SCIP_CHECKEDSOL*      checkedsol          /**< checked solution */
+   )
+{
+   assert(checkedsol != NULL);
+
+   return checkedsol->nviolrows;
+}
+
+/** returns the objective value of the working solution in the transformed problem; the solution updates it with every
+ *  changed value, so this takes constant time
+ */
+SCIP_Real SCIPgetCheckedSolObj(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL*      checkedsol          /**< checked solution */
+   )
+{
+   assert(scip != NULL);
+   assert(checkedsol != NULL);
+
+   return SCIPgetSolTransObj(scip, checkedsol->sol);
+}
+
+/** returns the activities of the LP rows in the working solution, indexed by the LP position of the rows */
+SCIP_Real* SCIPgetCheckedSolRowActivities(
+   SCIP_CHECKEDSOL*      checkedsol          /**< checked solution */
+   )
+{
+   assert(checkedsol != NULL);
+
+   return checkedsol->activities;
+}
+
+/** checks the working solution of a checked solution for feasibility and adds it to the solution storage if it is
+ *  feasible
+ *
+ *  The activities of the changed LP rows are recomputed from scratch first. The solution is rejected without a
+ *  feasibility check if it violates a global LP row. Otherwise, SCIPtrySol() is called with checklprows = FALSE unless a
+ *  local LP row is violated.
+ */
+SCIP_RETCODE SCIPtryCheckedSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL*      checkedsol,         /**< checked solution */
+   SCIP_Bool             printreason,        /**< Should all reasons of violation be printed? */
+   SCIP_Bool             completely,         /**< Should all violations be checked if printreason is true? */
+   SCIP_Bool             checkbounds,        /**< Should the bounds of the variables be checked? */
+   SCIP_Bool             checkintegrality,   /**< Has integrality to be checked? */
+   SCIP_Bool*            stored              /**< stores whether given solution was feasible and good enough to keep */
+   )
+{
+   SCIP_ROW** lprows;
+   int i;
+
+   assert(scip != NULL);
+   assert(checkedsol != NULL);
+   assert(stored != NULL);
+   assert(SCIPgetNLPRows(scip) == checkedsol->nlprows);
+
+   *stored = FALSE;
+
+   /* remove the numerical error of the incremental updates from the changed rows */
+   lprows = SCIPgetLPRows(scip);
+   for( i = 0; i < checkedsol->nchangedrows; ++i )
+   {
+      int rowpos;
+
+      rowpos = checkedsol->changedrows[i];
+      assert(checkedsol->changed[rowpos]);
+
+      checkedsol->activities[rowpos] = SCIPgetRowSolActivity(scip, lprows[rowpos], checkedsol->sol);
+      checkedsolUpdateViolation(scip, checkedsol, lprows[rowpos], rowpos);
+      checkedsol->changed[rowpos] = FALSE;
+   }
+   checkedsol->nchangedrows = 0;
+
+   if( checkedsol->nviolrows > 0 )
+      return SCIP_OKAY;
+
+   /* a violated local row may belong to a locally valid constraint, so the constraint handlers have to decide whether
+    * the solution is feasible
+    */
+   SCIP_CALL( SCIPtrySol(scip, checkedsol->sol, printreason, completely, checkbounds, checkintegrality,
+         checkedsol->nviollocalrows > 0, stored) );
+
+   return SCIP_OKAY;
+}
@@ -132,6 +132,84 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
    SCIP_Real             violpenalty         /**< the penalty for violating the trust region */
    );
 
+/** creates a checked solution that updates the activities of the LP rows when values of the working solution are
+ *  changed via SCIPsetCheckedSolVal()
+ *
+ *  The working solution has to be a transformed solution and the LP rows may not change while the checked solution is
+ *  in use. See SCIPtryCheckedSol() for the conditions under which the LP rows are not checked again.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateCheckedSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL**     checkedsol,         /**< pointer to store the checked solution */
+   SCIP_SOL*             sol                 /**< working solution, which is not copied */
+   );
+
+/** frees a checked solution; the working solution is not freed */
+SCIP_EXPORT
+void SCIPfreeCheckedSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL**     checkedsol          /**< pointer to the checked solution */
+   );
+
+/** sets the value of an active variable in the working solution and updates the activities of the LP rows of its column
+ *  in time linear in the column length
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetCheckedSolVal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL*      checkedsol,         /**< checked solution */
+   SCIP_VAR*             var,                /**< active variable to set the value for */
+   SCIP_Real             val                 /**< new value of the variable */
+   );
+
+/** returns the number of global LP rows that are violated by the working solution */
+SCIP_EXPORT
+int SCIPgetCheckedSolNViolRows(
+   SCIP_CHECKEDSOL*      checkedsol          /**< checked solution */
+   );
+
+/** returns the objective value of the working solution in the transformed problem; the solution updates it with every
+ *  changed value, so this takes constant time
+ */
+SCIP_EXPORT
+SCIP_Real SCIPgetCheckedSolObj(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL*      checkedsol          /**< checked solution */
+   );
+
+/** returns the activities of the LP rows in the working solution, indexed by the LP position of the rows */
+SCIP_EXPORT
+SCIP_Real* SCIPgetCheckedSolRowActivities(
+   SCIP_CHECKEDSOL*      checkedsol          /**< checked solution */
+   );
+
+/** checks the working solution of a checked solution for feasibility and adds it to the solution storage if it is
+ *  feasible
+ *
+ *  The activities of the changed LP rows are recomputed from scratch first. The solution is rejected without a
+ *  feasibility check if it violates a global LP row. Otherwise, SCIPtrySol() is called with checklprows = FALSE unless a
+ *  local LP row is violated, i.e., the constraint handlers do not check their constraints that are represented by rows
+ *  in the LP. This is only correct if
+ *  - the values of the working solution were changed only via SCIPsetCheckedSolVal() since the checked solution was
+ *    created, and
+ *  - no LP rows were added, removed, or changed since then.
+ *
+ *  Constraint handlers skip only constraints whose LP row is in the LP and represents the constraint completely, as for
+ *  the linear, knapsack, set partitioning/packing/covering, logicor, and varbound constraints; all other constraints
+ *  are checked as usual.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtryCheckedSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CHECKEDSOL*      checkedsol,         /**< checked solution */
+   SCIP_Bool             printreason,        /**< Should all reasons of violation be printed? */
+   SCIP_Bool             completely,         /**< Should all violations be checked if printreason is true? */
+   SCIP_Bool             checkbounds,        /**< Should the bounds of the variables be checked? */
+   SCIP_Bool             checkintegrality,   /**< Has integrality to be checked? */
+   SCIP_Bool*            stored              /**< stores whether given solution was feasible and good enough to keep */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
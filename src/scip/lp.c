@@ -64,6 +64,7 @@
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
 #include "scip/struct_var.h"
+#include "scip/trace.h"
 #include "scip/var.h"
 #include <string.h>
 
@@ -12066,8 +12067,10 @@ SCIP_RETCODE lpSolve(
 
  SOLVEAGAIN:
    /* call simplex */
+   SCIPtraceBegin(stat->trace, set);
    SCIP_CALL( lpSolveStable(lp, set, messagehdlr, stat, prob, lpalgo, itlim, harditlim, resolve, fastmip, tightprimfeastol, tightdualfeastol, fromscratch,
          scaling, keepsol, &timelimit, lperror) );
+   SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_LP, "lp");
    resolve = FALSE; /* only the first solve should be counted as resolving call */
    solvedprimal = solvedprimal || (lp->lastlpalgo == SCIP_LPALGO_PRIMALSIMPLEX);
    solveddual = solveddual || (lp->lastlpalgo == SCIP_LPALGO_DUALSIMPLEX);
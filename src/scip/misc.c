@@ -7046,6 +7046,140 @@ SCIP_RETCODE SCIPprofileInsertCore(
    return SCIP_OKAY;
 }
 
+/** inserts several cores into the resource profile at once in O((n + m) log(n + m)) time for n cores and m time
+ *  points; if the cores do not fit together due to the capacity, the resource profile is not changed
+ */
+SCIP_RETCODE SCIPprofileInsertCores(
+   SCIP_PROFILE*         profile,            /**< resource profile */
+   int                   ncores,             /**< number of cores */
+   int*                  lefts,              /**< left sides of the cores */
+   int*                  rights,             /**< right sides of the cores */
+   int*                  demands,            /**< demands of the cores */
+   SCIP_Bool*            infeasible          /**< pointer to store if the cores do not fit due to capacity */
+   )
+{
+   int* eventtimes;
+   int* eventdemands;
+   int* timepoints;
+   int* loads;
+   int nevents;
+   int ntimepoints;
+   int arraysize;
+   int load;
+   int demand;
+   int i;
+   int e;
+   int c;
+
+   assert(profile != NULL);
+   assert(ncores >= 0);
+   assert(infeasible != NULL);
+
+   (*infeasible) = FALSE;
+
+   if( ncores == 0 )
+      return SCIP_OKAY;
+
+   assert(lefts != NULL);
+   assert(rights != NULL);
+   assert(demands != NULL);
+
+   SCIP_ALLOC( BMSallocMemoryArray(&eventtimes, 2 * ncores) );
+   SCIP_ALLOC( BMSallocMemoryArray(&eventdemands, 2 * ncores) );
+
+   /* each core increases the load at its left side and decreases it at its right side */
+   nevents = 0;
+   for( c = 0; c < ncores; ++c )
+   {
+      assert(lefts[c] >= 0);
+      assert(lefts[c] < rights[c]);
+      assert(demands[c] >= 0);
+
+      /* empty cores do not change the resource profile */
+      if( demands[c] == 0 )
+         continue;
+
+      eventtimes[nevents] = lefts[c];
+      eventdemands[nevents] = demands[c];
+      ++nevents;
+      eventtimes[nevents] = rights[c];
+      eventdemands[nevents] = -demands[c];
+      ++nevents;
+   }
+
+   SCIPsortIntInt(eventtimes, eventdemands, nevents);
+
+   arraysize = MAX(profile->arraysize, profile->ntimepoints + nevents);
+   SCIP_ALLOC( BMSallocMemoryArray(&timepoints, arraysize) );
+   SCIP_ALLOC( BMSallocMemoryArray(&loads, arraysize) );
+
+   /* merge the time points of the resource profile with the sorted events; the load at each time point is the load of
+    * the resource profile plus the demands of all cores which started but did not end yet
+    */
+   ntimepoints = 0;
+   load = 0;
+   demand = 0;
+   i = 0;
+   e = 0;
+   while( i < profile->ntimepoints || e < nevents )
+   {
+      int timepoint;
+
+      if( e == nevents || (i < profile->ntimepoints && profile->timepoints[i] <= eventtimes[e]) )
+         timepoint = profile->timepoints[i];
+      else
+         timepoint = eventtimes[e];
+
+      if( i < profile->ntimepoints && profile->timepoints[i] == timepoint )
+      {
+         load = profile->loads[i];
+         ++i;
+      }
+
+      while( e < nevents && eventtimes[e] == timepoint )
+      {
+         demand += eventdemands[e];
+         ++e;
+      }
+
+      timepoints[ntimepoints] = timepoint;
+      loads[ntimepoints] = load + demand;
+
+      /* check if the cores fit */
+      if( loads[ntimepoints] > profile->capacity )
+      {
+         SCIPdebugMessage("core insertion detected infeasibility (time point %d)\n", timepoint);
+
+         (*infeasible) = TRUE;
+         break;
+      }
+
+      ++ntimepoints;
+   }
+   assert(*infeasible || demand == 0);
+
+   if( *infeasible )
+   {
+      BMSfreeMemoryArray(&loads);
+      BMSfreeMemoryArray(&timepoints);
+   }
+   else
+   {
+      BMSfreeMemoryArray(&profile->loads);
+      BMSfreeMemoryArray(&profile->timepoints);
+
+      profile->timepoints = timepoints;
+      profile->loads = loads;
+      profile->ntimepoints = ntimepoints;
+      profile->arraysize = arraysize;
+   }
+
+   BMSfreeMemoryArray(&eventdemands);
+   BMSfreeMemoryArray(&eventtimes);
+
+   return SCIP_OKAY;
+}
+
 /** subtracts the demand from the resource profile during core time */
 SCIP_RETCODE SCIPprofileDeleteCore(
    SCIP_PROFILE*         profile,            /**< resource profile to use */
@@ -103,6 +103,31 @@ SCIP_RETCODE pricestoreEnsureBdviolvarsMem(
 }
 
 
+/** resizes stability center arrays to be able to store at least num entries */
+static
+SCIP_RETCODE pricestoreEnsureCenterMem(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of slots in array */
+   )
+{
+   assert(pricestore != NULL);
+   assert(set != NULL);
+
+   if( num > pricestore->centersize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocMemoryArray(&pricestore->centerduals, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&pricestore->centerrowidx, newsize) );
+      pricestore->centersize = newsize;
+   }
+   assert(num <= pricestore->centersize);
+
+   return SCIP_OKAY;
+}
+
 /** creates pricing storage */
 SCIP_RETCODE SCIPpricestoreCreate(
    SCIP_PRICESTORE**     pricestore          /**< pointer to store pricing storage */
@@ -118,16 +143,25 @@ SCIP_RETCODE SCIPpricestoreCreate(
    (*pricestore)->bdviolvars = NULL;
    (*pricestore)->bdviolvarslb = NULL;
    (*pricestore)->bdviolvarsub = NULL;
+   (*pricestore)->centerduals = NULL;
+   (*pricestore)->centerrowidx = NULL;
+   (*pricestore)->centerbound = -SCIP_INVALID;
+   (*pricestore)->smoothing = 0.0;
+   (*pricestore)->centernode = -1;
    (*pricestore)->varssize = 0;
    (*pricestore)->nvars = 0;
    (*pricestore)->bdviolvarssize = 0;
    (*pricestore)->nbdviolvars = 0;
    (*pricestore)->naddedbdviolvars = 0;
+   (*pricestore)->centersize = 0;
+   (*pricestore)->ncenterrows = 0;
+   (*pricestore)->nmispricings = 0;
    (*pricestore)->nprobpricings = 0;
    (*pricestore)->nprobvarsfound = 0;
    (*pricestore)->nvarsfound = 0;
    (*pricestore)->nvarsapplied = 0;
    (*pricestore)->initiallp = FALSE;
+   (*pricestore)->pretendroot = FALSE;
 
    return SCIP_OKAY;
 }
@@ -148,6 +182,8 @@ SCIP_RETCODE SCIPpricestoreFree(
    BMSfreeMemoryArrayNull(&(*pricestore)->bdviolvars);
    BMSfreeMemoryArrayNull(&(*pricestore)->bdviolvarslb);
    BMSfreeMemoryArrayNull(&(*pricestore)->bdviolvarsub);
+   BMSfreeMemoryArrayNull(&(*pricestore)->centerrowidx);
+   BMSfreeMemoryArrayNull(&(*pricestore)->centerduals);
    BMSfreeMemory(pricestore);
 
    return SCIP_OKAY;
@@ -177,6 +213,17 @@ void SCIPpricestoreEndInitialLP(
    pricestore->initiallp = FALSE;
 }
 
+/** informs pricing storage whether the pricers of the following pricing loop are called as if we are at the root node */
+void SCIPpricestoreSetPretendRoot(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_Bool             pretendroot         /**< should the pricers be called as if we are at the root node? */
+   )
+{
+   assert(pricestore != NULL);
+
+   pricestore->pretendroot = pretendroot;
+}
+
 /** adds variable to pricing storage and capture it */
 SCIP_RETCODE SCIPpricestoreAddVar(
    SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
@@ -605,6 +652,141 @@ SCIP_RETCODE SCIPpricestoreResetBounds(
    return SCIP_OKAY;
 }
 
+/** starts dual smoothing for the pricing loop at the given node; the stability center of another node is discarded */
+void SCIPpricestoreStartSmoothing(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_Longint          nodenumber          /**< number of the node whose LP is priced */
+   )
+{
+   assert(pricestore != NULL);
+
+   if( pricestore->centernode != nodenumber )
+   {
+      pricestore->centernode = nodenumber;
+      pricestore->centerbound = -SCIP_INVALID;
+      pricestore->ncenterrows = 0;
+   }
+   pricestore->smoothing = 0.0;
+}
+
+/** sets the smoothing factor of the dual values that the pricers of the current pricing round use */
+void SCIPpricestoreSetSmoothing(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_Real             smoothing           /**< smoothing factor in [0,1); 0.0 gives the dual values of the LP */
+   )
+{
+   assert(pricestore != NULL);
+   assert(0.0 <= smoothing && smoothing < 1.0);
+
+   pricestore->smoothing = smoothing;
+}
+
+/** returns whether the dual values of the current pricing round differ from the dual values of the LP */
+SCIP_Bool SCIPpricestoreIsSmoothing(
+   SCIP_PRICESTORE*      pricestore          /**< pricing storage */
+   )
+{
+   assert(pricestore != NULL);
+
+   return pricestore->smoothing > 0.0 && pricestore->ncenterrows > 0;
+}
+
+/** returns the dual value of an LP row that the pricers of the current pricing round use
+ *
+ *  With dual smoothing, this is the convex combination smoothing * center + (1 - smoothing) * LP dual value; rows
+ *  that were not in the LP at the stability center get their LP dual value.
+ */
+SCIP_Real SCIPpricestoreGetRowDualsol(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_ROW*             row                 /**< LP row */
+   )
+{
+   SCIP_Real dualsol;
+   int pos;
+
+   assert(pricestore != NULL);
+   assert(row != NULL);
+
+   dualsol = SCIProwGetDualsol(row);
+
+   if( pricestore->smoothing == 0.0 ) /*lint !e777*/
+      return dualsol;
+
+   pos = SCIProwGetLPPos(row);
+   if( pos < 0 || pos >= pricestore->ncenterrows || pricestore->centerrowidx[pos] != SCIProwGetIndex(row) )
+      return dualsol;
+
+   return pricestore->smoothing * pricestore->centerduals[pos] + (1.0 - pricestore->smoothing) * dualsol;
+}
+
+/** moves the stability center of dual smoothing to the dual values of the current pricing round
+ *
+ *  If the pricers reported a lower bound, the center is only moved if the bound improves on the bound at the center
+ *  (Wentges smoothing). Otherwise, the center always follows the smoothed dual values (Neame smoothing).
+ */
+SCIP_RETCODE SCIPpricestoreUpdateSmoothingCenter(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_Real             lowerbound          /**< best lower bound reported by the pricers in this round */
+   )
+{
+   SCIP_ROW** rows;
+   int nrows;
+   int r;
+
+   assert(pricestore != NULL);
+   assert(set != NULL);
+   assert(lp != NULL);
+
+   if( !SCIPsetIsInfinity(set, -lowerbound) )
+   {
+      if( pricestore->centerbound != -SCIP_INVALID && lowerbound <= pricestore->centerbound ) /*lint !e777*/
+         return SCIP_OKAY;
+
+      pricestore->centerbound = lowerbound;
+   }
+
+   rows = SCIPlpGetRows(lp);
+   nrows = SCIPlpGetNRows(lp);
+
+   SCIP_CALL( pricestoreEnsureCenterMem(pricestore, set, nrows) );
+
+   /* each row only reads its own center value, so the center can be overwritten in place */
+   for( r = 0; r < nrows; ++r )
+   {
+      pricestore->centerduals[r] = SCIPpricestoreGetRowDualsol(pricestore, rows[r]);
+      pricestore->centerrowidx[r] = SCIProwGetIndex(rows[r]);
+   }
+   pricestore->ncenterrows = nrows;
+
+   return SCIP_OKAY;
+}
+
+/** increases the number of pricing rounds that were repeated with the LP duals, because no variable was found with the
+ *  smoothed duals
+ */
+void SCIPpricestoreIncNMispricings(
+   SCIP_PRICESTORE*      pricestore          /**< pricing storage */
+   )
+{
+   assert(pricestore != NULL);
+
+   pricestore->nmispricings++;
+}
+
+/** gets number of pricing rounds that were repeated with the LP duals, because no variable was found with the smoothed
+ *  duals
+ */
+int SCIPpricestoreGetNMispricings(
+   SCIP_PRICESTORE*      pricestore          /**< pricing storage */
+   )
+{
+   assert(pricestore != NULL);
+
+   return pricestore->nmispricings;
+}
+
 /** gets number of variables in pricing storage */
 int SCIPpricestoreGetNVars(
    SCIP_PRICESTORE*      pricestore          /**< pricing storage */
@@ -616,6 +798,34 @@ int SCIPpricestoreGetNVars(
    return pricestore->nvars + pricestore->nbdviolvars - pricestore->naddedbdviolvars;
 }
 
+/** returns whether the pricing storage contains enough variables such that the remaining pricers of the current
+ *  pricing round can be skipped
+ *
+ *  This is the case if more variables were found than can be applied in this round, or if at least pricing/partialvars
+ *  variables were found (partial pricing). The maximal number of variables is taken w.r.t. the root flag of the
+ *  current pricing loop, see SCIPpricestoreSetPretendRoot().
+ */
+SCIP_Bool SCIPpricestoreHasEnoughVars(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int maxpricevars;
+   int nvars;
+
+   assert(pricestore != NULL);
+   assert(set != NULL);
+
+   nvars = SCIPpricestoreGetNVars(pricestore);
+
+   if( nvars >= set->price_partialvars )
+      return TRUE;
+
+   maxpricevars = SCIPsetGetPriceMaxvars(set, pricestore->pretendroot);
+
+   return maxpricevars < INT_MAX && nvars >= maxpricevars + 1;
+}
+
 /** gets number of variables in pricing storage whose bounds must be reset */
 int SCIPpricestoreGetNBoundResets(
    SCIP_PRICESTORE*      pricestore          /**< pricing storage */
@@ -71,6 +71,12 @@ void SCIPpricestoreEndInitialLP(
    SCIP_PRICESTORE*      pricestore          /**< pricing storage */
    );
 
+/** informs pricing storage whether the pricers of the following pricing loop are called as if we are at the root node */
+void SCIPpricestoreSetPretendRoot(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_Bool             pretendroot         /**< should the pricers be called as if we are at the root node? */
+   );
+
 /** adds variable to pricing storage and capture it */
 SCIP_RETCODE SCIPpricestoreAddVar(
    SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
@@ -131,11 +137,64 @@ SCIP_RETCODE SCIPpricestoreResetBounds(
    SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
    );
 
+/** starts dual smoothing for the pricing loop at the given node; the stability center of another node is discarded */
+void SCIPpricestoreStartSmoothing(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_Longint          nodenumber          /**< number of the node whose LP is priced */
+   );
+
+/** sets the smoothing factor of the dual values that the pricers of the current pricing round use */
+void SCIPpricestoreSetSmoothing(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_Real             smoothing           /**< smoothing factor in [0,1); 0.0 gives the dual values of the LP */
+   );
+
+/** returns whether the dual values of the current pricing round differ from the dual values of the LP */
+SCIP_Bool SCIPpricestoreIsSmoothing(
+   SCIP_PRICESTORE*      pricestore          /**< pricing storage */
+   );
+
+/** returns the dual value of an LP row that the pricers of the current pricing round use */
+SCIP_Real SCIPpricestoreGetRowDualsol(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_ROW*             row                 /**< LP row */
+   );
+
+/** moves the stability center of dual smoothing to the dual values of the current pricing round */
+SCIP_RETCODE SCIPpricestoreUpdateSmoothingCenter(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_Real             lowerbound          /**< best lower bound reported by the pricers in this round */
+   );
+
+/** increases the number of pricing rounds that were repeated with the LP duals, because no variable was found with the
+ *  smoothed duals
+ */
+void SCIPpricestoreIncNMispricings(
+   SCIP_PRICESTORE*      pricestore          /**< pricing storage */
+   );
+
+/** gets number of pricing rounds that were repeated with the LP duals, because no variable was found with the smoothed
+ *  duals
+ */
+int SCIPpricestoreGetNMispricings(
+   SCIP_PRICESTORE*      pricestore          /**< pricing storage */
+   );
+
 /** gets number of variables in pricing storage */
 int SCIPpricestoreGetNVars(
    SCIP_PRICESTORE*      pricestore          /**< pricing storage */
    );
 
+/** returns whether the pricing storage contains enough variables such that the remaining pricers of the current
+ *  pricing round can be skipped
+ */
+SCIP_Bool SCIPpricestoreHasEnoughVars(
+   SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
 /** gets number of variables in pricing storage whose bounds must be reset */
 int SCIPpricestoreGetNBoundResets(
    SCIP_PRICESTORE*      pricestore          /**< pricing storage */
@@ -37,6 +37,8 @@
 #include "scip/def.h"
 #include "scip/set.h"
 #include "scip/stat.h"
+#include "scip/struct_stat.h"
+#include "scip/trace.h"
 #include "scip/clock.h"
 #include "scip/paramset.h"
 #include "scip/var.h"
@@ -681,7 +683,9 @@ SCIP_RETCODE SCIPpropExec(
             SCIPclockStart(prop->proptime, set);
 
          /* call external propagation method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( prop->propexec(set->scip, prop, proptiming, result) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_PROP, prop->name);
 
          /* stop timing */
          if( instrongbranching )
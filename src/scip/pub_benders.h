@@ -248,6 +248,18 @@ int SCIPbendersGetNStoredCuts(
    SCIP_BENDERS*         benders             /**< Benders' decomposition cut */
    );
 
+/** returns the number of generated cuts that were identified as near-duplicates of recently added cuts */
+SCIP_EXPORT
+int SCIPbendersGetNDuplicateCuts(
+   SCIP_BENDERS*         benders             /**< Benders' decomposition */
+   );
+
+/** returns the number of aggregated optimality cuts that were added, see parameter benders/<name>/cutaggrsize */
+SCIP_EXPORT
+int SCIPbendersGetNAggregatedCuts(
+   SCIP_BENDERS*         benders             /**< Benders' decomposition */
+   );
+
 /** returns the data for the cuts that have been added by the Benders' cut plugin */
 SCIP_EXPORT
 SCIP_RETCODE SCIPbendersGetStoredCutData(
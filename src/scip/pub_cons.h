@@ -540,6 +540,28 @@ void SCIPconshdlrSetPresolTiming(
    SCIP_PRESOLTIMING     presoltiming        /** timing mask to be set */
    );
 
+/** sets whether the feasibility check of the constraint handler is independent of the order in which the constraint
+ *  handlers are checked
+ *
+ *  The check of such a constraint handler must neither rely on other constraint handlers being checked before, e.g.,
+ *  on the integrality of the solution, nor have side effects apart from updating the violation of the solution and the
+ *  ages of the constraints. The check of a solution can then start with this constraint handler if it rejected the
+ *  previous solution.
+ */
+SCIP_EXPORT
+void SCIPconshdlrSetIndependentCheck(
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_Bool             independentcheck    /**< is the check independent of the check order? */
+   );
+
+/** returns whether the feasibility check of the constraint handler is independent of the order in which the constraint
+ *  handlers are checked
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPconshdlrHasIndependentCheck(
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   );
+
 /** returns whether conshdlr supports permutation symmetry detection */
 SCIP_EXPORT
 SCIP_Bool SCIPconshdlrSupportsPermsymDetection(
@@ -1028,6 +1028,41 @@ SCIP_Bool SCIPexpriterIsEnd(
 
 /** @} */
 
+/**@name Expression Evaluation Tape
+ *
+ * An expression evaluation tape is a flat sequence of instructions that is compiled once from an expression and can
+ * then be used to evaluate the expression and its gradient without walking the expression with an iterator.
+ * See SCIPcreateExprTape().
+ *
+ * @{
+ */
+
+/** gives the root expression of an expression evaluation tape */
+SCIP_EXPORT
+SCIP_EXPR* SCIPexprtapeGetRoot(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   );
+
+/** gives the number of distinct variables of an expression evaluation tape */
+SCIP_EXPORT
+int SCIPexprtapeGetNVars(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   );
+
+/** gives the distinct variables of an expression evaluation tape, in the order that is used for batch evaluation */
+SCIP_EXPORT
+SCIP_VAR** SCIPexprtapeGetVars(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   );
+
+/** gives the number of instructions of an expression evaluation tape */
+SCIP_EXPORT
+int SCIPexprtapeGetNInstrs(
+   SCIP_EXPRTAPE*        tape                /**< expression evaluation tape */
+   );
+
+/** @} */
+
 /**@name Function Curvature */
 /**@{ */
 
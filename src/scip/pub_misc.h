@@ -1288,6 +1288,22 @@ SCIP_RETCODE SCIPprofileInsertCore(
    SCIP_Bool*            infeasible          /**< pointer to store if the core does not fit due to capacity */
    );
 
+/** inserts several cores into the resource profile at once in O((n + m) log(n + m)) time for n cores and m time
+ *  points; if the cores do not fit together due to the capacity, the resource profile is not changed
+ *
+ *  @note the resulting resource profile is the same as after inserting the cores one after the other with
+ *        SCIPprofileInsertCore()
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPprofileInsertCores(
+   SCIP_PROFILE*         profile,            /**< resource profile to use */
+   int                   ncores,             /**< number of cores */
+   int*                  lefts,              /**< left sides of the cores */
+   int*                  rights,             /**< right sides of the cores */
+   int*                  heights,            /**< heights of the cores */
+   SCIP_Bool*            infeasible          /**< pointer to store if the cores do not fit due to capacity */
+   );
+
 /** subtracts the height from the resource profile during core time */
 SCIP_EXPORT
 SCIP_RETCODE SCIPprofileDeleteCore(
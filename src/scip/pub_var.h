@@ -1466,7 +1466,7 @@ SCIP_HOLELIST* SCIPholelistGetNext(
 #define SCIPbdchginfoGetInferVar(bdchginfo)       (bdchginfo)->inferencedata.var
 #define SCIPbdchginfoGetInferCons(bdchginfo)      (bdchginfo)->inferencedata.reason.cons
 #define SCIPbdchginfoGetInferProp(bdchginfo)      (bdchginfo)->inferencedata.reason.prop
-#define SCIPbdchginfoGetInferInfo(bdchginfo)      (bdchginfo)->inferencedata.info
+#define SCIPbdchginfoGetInferInfo(bdchginfo)      (bdchginfo)->inferinfo
 #define SCIPbdchginfoGetInferBoundtype(bdchginfo) (SCIP_BOUNDTYPE)((bdchginfo)->inferboundtype)
 #define SCIPbdchginfoIsRedundant(bdchginfo)       (bdchginfo)->redundant
 #define SCIPbdchginfoHasInferenceReason(bdchginfo)                      \
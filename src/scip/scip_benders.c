@@ -1385,6 +1385,114 @@ SCIP_RETCODE SCIPstoreBendersCut(
    return SCIP_OKAY;
 }
 
+/** searches the recently added Benders' cuts for a near-duplicate of the given cut of the form vals * vars >= lhs
+ *
+ *  A recently added cut is returned as duplicate if it has the same support, is nearly parallel and at least as strong
+ *  as the given cut, and its row is currently not in the LP but violated by the given solution. In this case, the
+ *  row of the previous cut can be added again instead of a new, nearly parallel cut. If no duplicate is found or the
+ *  duplicate detection is disabled, then duprow is set to NULL.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPfindBendersDuplicateCut(
+   SCIP*                 scip,               /**< the SCIP data structure */
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SOL*             sol,                /**< the solution that is separated by the cut, can be NULL */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_ROW**            duprow              /**< pointer to store the row of the duplicate cut, or NULL */
+   )
+{
+   assert(scip != NULL);
+   assert(benders != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPfindBendersDuplicateCut", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPbendersFindDuplicateCut(benders, scip->set, sol, vars, vals, lhs, nvars, duprow) );
+
+   return SCIP_OKAY;
+}
+
+/** records an added Benders' cut of the form vals * vars >= lhs for the detection of near-duplicate cuts
+ *
+ *  The given row or constraint is captured and kept in a rotating memory of size benders/<name>/dedupmemsize, in
+ *  which the oldest cut is replaced first. Nothing is done if the duplicate detection is disabled.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPrecordBendersCut(
+   SCIP*                 scip,               /**< the SCIP data structure */
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_ROW*             row,                /**< the row that was added for the cut, or NULL */
+   SCIP_CONS*            cons                /**< the constraint that was added for the cut, or NULL */
+   )
+{
+   assert(scip != NULL);
+   assert(benders != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPrecordBendersCut", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPbendersRecordCut(benders, scip->set, vars, vals, lhs, nvars, row, cons) );
+
+   return SCIP_OKAY;
+}
+
+/** adds an optimality cut of the form vals * vars >= lhs of a subproblem to the aggregated cut of its block of
+ *  subproblems
+ *
+ *  The subproblems are partitioned into blocks of benders/<name>/cutaggrsize consecutive subproblems, and the cuts of
+ *  each block are summed up to a single cut. The aggregated cuts are added to the master problem after the cuts of all
+ *  subproblems have been generated for the current solution. If aggregated is FALSE on return, then the cut aggregation
+ *  is disabled and the caller has to add the cut itself.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPaggregateBendersCut(
+   SCIP*                 scip,               /**< the SCIP data structure */
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   int                   probnumber,         /**< the subproblem that generated the cut */
+   SCIP_Bool             addcut,             /**< should the aggregated cut be added as a row instead of a constraint? */
+   SCIP_Bool*            aggregated          /**< pointer to store whether the cut was aggregated */
+   )
+{
+   assert(scip != NULL);
+   assert(benders != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPaggregateBendersCut", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPbendersAggregateCut(benders, scip->set, vars, vals, lhs, nvars, probnumber, addcut, aggregated) );
+
+   return SCIP_OKAY;
+}
+
 /** creates a constraint in the input SCIP instance that corresponds to the given vars and vals arrays */
 static
 SCIP_RETCODE createAndApplyStoredBendersCut(
@@ -1647,6 +1647,111 @@ SCIP_RETCODE SCIPevalExpr(
    return SCIP_OKAY;
 }
 
+/** evaluates an expression and, optionally, its gradient in many points at once
+ *
+ * The expression is compiled into an evaluation tape (see SCIPcreateExprTape()), which is then run for all points
+ * at once. The loops of the sum, product, power, signpower, exp, log, and abs expressions are run over all points,
+ * which is much faster than calling SCIPevalExpr() and SCIPevalExprGradient() for each point if many points are
+ * evaluated. Since the tape is compiled anew in every call, callers that evaluate the same expression repeatedly
+ * should keep a tape from SCIPcreateExprTape() and evaluate it with SCIPevalExprTapeBatch() instead.
+ *
+ * The value of the expression in the k-th point is stored in vals[k]. If gradients are requested, then the partial
+ * derivative w.r.t. gradvars[i] in the k-th point is stored in grads[i * npoints + k]; variables that do not appear
+ * in the expression get a partial derivative of 0.0. If the expression or its gradient cannot be evaluated in a
+ * point, then SCIP_INVALID is stored as value or as all partial derivatives of this point, respectively.
+ *
+ * The values and derivatives that are stored in the expressions themselves are not changed.
+ */
+SCIP_RETCODE SCIPevalExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   SCIP_SOL**            sols,               /**< points to evaluate the expression in */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            vals,               /**< array of size npoints to store the values of the expression */
+   SCIP_VAR**            gradvars,           /**< variables to compute partial derivatives for, or NULL */
+   int                   ngradvars,          /**< number of variables in gradvars */
+   SCIP_Real*            grads               /**< array of size ngradvars * npoints to store the partial derivatives,
+                                              *   or NULL if no gradients are needed */
+   )
+{
+   SCIP_EXPRTAPE* tape;
+   SCIP_VAR** tapevars;
+   SCIP_Real* varvals;
+   SCIP_Real* slotvals = NULL;
+   int ntapevars;
+   int k;
+   int v;
+
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+   assert(expr != NULL);
+   assert(sols != NULL || npoints == 0);
+   assert(vals != NULL || npoints == 0);
+   assert(grads == NULL || gradvars != NULL || ngradvars == 0);
+
+   if( npoints == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPexprtapeCreate(scip->set, scip->stat, scip->mem->probmem, expr, &tape) );
+
+   tapevars = SCIPexprtapeGetVars(tape);
+   ntapevars = SCIPexprtapeGetNVars(tape);
+
+   /* collect the values of the variables of the expression in structure-of-arrays layout */
+   SCIP_CALL( SCIPallocBufferArray(scip, &varvals, MAX(ntapevars * npoints, 1)) );
+   for( v = 0; v < ntapevars; ++v )
+      for( k = 0; k < npoints; ++k )
+         varvals[v * npoints + k] = SCIPgetSolVal(scip, sols[k], tapevars[v]);
+
+   if( grads != NULL )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &slotvals, SCIPexprtapeGetNInstrs(tape) * npoints) );
+   }
+
+   SCIP_CALL( SCIPexprtapeEvalBatch(scip->set, scip->mem->buffer, tape, npoints, varvals, vals, slotvals) );
+
+   if( grads != NULL )
+   {
+      SCIP_HASHMAP* var2idx;
+      SCIP_Real* tapegrads;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &tapegrads, MAX(ntapevars * npoints, 1)) );
+      SCIP_CALL( SCIPexprtapeEvalBatchGradient(scip->set, scip->mem->buffer, tape, npoints, slotvals, vals, tapegrads) );
+
+      SCIP_CALL( SCIPhashmapCreate(&var2idx, SCIPblkmem(scip), MAX(ntapevars, 1)) );
+      for( v = 0; v < ntapevars; ++v )
+      {
+         SCIP_CALL( SCIPhashmapInsertInt(var2idx, (void*)tapevars[v], v) );
+      }
+
+      for( v = 0; v < ngradvars; ++v )
+      {
+         SCIP_Real* grad = &grads[v * npoints];
+
+         if( SCIPhashmapExists(var2idx, (void*)gradvars[v]) )
+         {
+            BMScopyMemoryArray(grad, &tapegrads[SCIPhashmapGetImageInt(var2idx, (void*)gradvars[v]) * npoints], npoints);  /*lint !e866*/
+         }
+         else
+         {
+            /* the gradient is invalid in points where the expression could not be evaluated */
+            for( k = 0; k < npoints; ++k )
+               grad[k] = vals[k] == SCIP_INVALID || (ntapevars > 0 && tapegrads[k] == SCIP_INVALID) ? SCIP_INVALID : 0.0; /*lint !e777*/
+         }
+      }
+
+      SCIPhashmapFree(&var2idx);
+      SCIPfreeBufferArray(scip, &tapegrads);
+      SCIPfreeBufferArray(scip, &slotvals);
+   }
+
+   SCIPfreeBufferArray(scip, &varvals);
+
+   SCIP_CALL( SCIPexprtapeFree(scip->set, scip->stat, scip->mem->probmem, &tape) );
+
+   return SCIP_OKAY;
+}
+
 /** returns a previously unused solution tag for expression evaluation */
 SCIP_Longint SCIPgetExprNewSoltag(
    SCIP*                 scip                /**< SCIP data structure */
@@ -2333,6 +2438,99 @@ SCIP_DECL_EXPRGETSYMDATA(SCIPcallExprGetSymData)
 #undef SCIPfreeExpriter
 #endif
 
+/** compiles an expression into an evaluation tape
+ *
+ * The expression is captured by the tape.
+ */
+SCIP_RETCODE SCIPcreateExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE**       tape,               /**< buffer to store the created tape */
+   SCIP_EXPR*            expr                /**< expression to compile */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIP_CALL( SCIPexprtapeCreate(scip->set, scip->stat, scip->mem->probmem, expr, tape) );
+
+   return SCIP_OKAY;
+}
+
+/** frees an expression evaluation tape and releases its expression */
+SCIP_RETCODE SCIPfreeExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE**       tape                /**< pointer to the tape to free */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIP_CALL( SCIPexprtapeFree(scip->set, scip->stat, scip->mem->probmem, tape) );
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the expression of a tape for a given point
+ *
+ * The values are stored in the expressions as by SCIPevalExpr(), see SCIPexprGetEvalValue().
+ * If an error (division by zero, ...) occurs, the value of the expression is set to SCIP_INVALID.
+ */
+SCIP_RETCODE SCIPevalExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   assert(scip != NULL);
+
+   SCIP_CALL( SCIPexprtapeEval(scip->set, tape, sol, soltag) );
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the gradient of the expression of a tape for a given point
+ *
+ * The partial derivatives are stored in the expressions as by SCIPevalExprGradient(), see SCIPexprGetDerivative().
+ * If an error (division by zero, ...) occurs, the derivative of the expression is set to SCIP_INVALID.
+ */
+SCIP_RETCODE SCIPevalExprTapeGradient(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   assert(scip != NULL);
+
+   SCIP_CALL( SCIPexprtapeEvalGradient(scip->set, scip->stat, tape, sol, soltag) );
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the expression of a tape for many points at once
+ *
+ * The values of the variables are given in structure-of-arrays layout, that is, varvals[v * npoints + k] is the value
+ * of the variable SCIPexprtapeGetVars()[v] in the k-th point. The values of the expression are stored in vals; if the
+ * expression cannot be evaluated in a point, SCIP_INVALID is stored for this point. The values that are stored in
+ * the expressions themselves are not changed.
+ */
+SCIP_RETCODE SCIPevalExprTapeBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of the variables in all points (structure-of-arrays) */
+   SCIP_Real*            vals                /**< array to store the values of the expression in all points */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIP_CALL( SCIPexprtapeEvalBatch(scip->set, scip->mem->buffer, tape, npoints, varvals, vals, NULL) );
+
+   return SCIP_OKAY;
+}
+
 /** creates an expression iterator */
 SCIP_RETCODE SCIPcreateExpriter(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -431,6 +431,34 @@ SCIP_RETCODE SCIPevalExpr(
    SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
    );
 
+/** evaluates an expression and, optionally, its gradient in many points at once
+ *
+ * The expression is compiled into an evaluation tape (see SCIPcreateExprTape()), which is then run for all points
+ * at once. The loops of the sum, product, power, signpower, exp, log, and abs expressions are run over all points,
+ * which is much faster than calling SCIPevalExpr() and SCIPevalExprGradient() for each point if many points are
+ * evaluated. Since the tape is compiled anew in every call, callers that evaluate the same expression repeatedly
+ * should keep a tape from SCIPcreateExprTape() and evaluate it with SCIPevalExprTapeBatch() instead.
+ *
+ * The value of the expression in the k-th point is stored in vals[k]. If gradients are requested, then the partial
+ * derivative w.r.t. gradvars[i] in the k-th point is stored in grads[i * npoints + k]; variables that do not appear
+ * in the expression get a partial derivative of 0.0. If the expression or its gradient cannot be evaluated in a
+ * point, then SCIP_INVALID is stored as value or as all partial derivatives of this point, respectively.
+ *
+ * The values and derivatives that are stored in the expressions themselves are not changed.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   SCIP_SOL**            sols,               /**< points to evaluate the expression in */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            vals,               /**< array of size npoints to store the values of the expression */
+   SCIP_VAR**            gradvars,           /**< variables to compute partial derivatives for, or NULL */
+   int                   ngradvars,          /**< number of variables in gradvars */
+   SCIP_Real*            grads               /**< array of size ngradvars * npoints to store the partial derivatives,
+                                              *   or NULL if no gradients are needed */
+   );
+
 /** returns a previously unused solution tag for expression evaluation */
 SCIP_EXPORT
 SCIP_Longint SCIPgetExprNewSoltag(
@@ -1020,6 +1048,78 @@ void SCIPfreeExpriter(
 /** @} */
 
 
+/**@name Expression Evaluation Tapes
+ *
+ * An evaluation tape compiles an expression into a flat sequence of instructions. Evaluations on the tape have the
+ * same effect as SCIPevalExpr() and SCIPevalExprGradient(), but avoid the expression walk and, for the basic
+ * expression handlers, the calls of the expression handler callbacks. This pays off if the same expression is
+ * evaluated very often. The tape becomes invalid if the expression or one of its subexpressions is modified.
+ */
+/**@{ */
+
+/** compiles an expression into an evaluation tape
+ *
+ * The expression is captured by the tape.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE**       tape,               /**< buffer to store the created tape */
+   SCIP_EXPR*            expr                /**< expression to compile */
+   );
+
+/** frees an expression evaluation tape and releases its expression */
+SCIP_EXPORT
+SCIP_RETCODE SCIPfreeExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE**       tape                /**< pointer to the tape to free */
+   );
+
+/** evaluates the expression of a tape for a given point
+ *
+ * The values are stored in the expressions as by SCIPevalExpr(), see SCIPexprGetEvalValue().
+ * If an error (division by zero, ...) occurs, the value of the expression is set to SCIP_INVALID.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
+/** evaluates the gradient of the expression of a tape for a given point
+ *
+ * The partial derivatives are stored in the expressions as by SCIPevalExprGradient(), see SCIPexprGetDerivative().
+ * If an error (division by zero, ...) occurs, the derivative of the expression is set to SCIP_INVALID.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprTapeGradient(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
+/** evaluates the expression of a tape for many points at once
+ *
+ * The values of the variables are given in structure-of-arrays layout, that is, varvals[v * npoints + k] is the value
+ * of the variable SCIPexprtapeGetVars()[v] in the k-th point. The values of the expression are stored in vals; if the
+ * expression cannot be evaluated in a point, SCIP_INVALID is stored for this point. The values that are stored in
+ * the expressions themselves are not changed.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprTapeBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRTAPE*        tape,               /**< expression evaluation tape */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of the variables in all points (structure-of-arrays) */
+   SCIP_Real*            vals                /**< array to store the values of the expression in all points */
+   );
+
+/** @} */
+
+
 /**@name Quadratic Expressions */
 /**@{ */
 
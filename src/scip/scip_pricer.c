@@ -44,6 +44,7 @@
 
 #include "scip/debug.h"
 #include "scip/pricer.h"
+#include "scip/pricestore.h"
 #include "scip/pub_message.h"
 #include "scip/scip_pricer.h"
 #include "scip/set.h"
@@ -355,6 +356,47 @@ int SCIPgetNActivePricers(
    return scip->set->nactivepricers;
 }
 
+/** returns whether enough variables have been priced in the current pricing round, such that the remaining pricers of
+ *  the round are skipped
+ *
+ *  Pricers that solve several independent pricing subproblems can use this to stop after a subproblem and skip the
+ *  remaining ones (partial pricing), see parameter pricing/partialvars. Another pricing round follows as long as
+ *  variables are added, so the final LP bound remains valid.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_Bool SCIPhasEnoughPricedVars(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPhasEnoughPricedVars", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   return SCIPpricestoreHasEnoughVars(scip->pricestore, scip->set);
+}
+
+/** returns the dual value of an LP row that pricers should use in their reduced cost pricing
+ *
+ *  Without dual smoothing, this is the dual value of the row in the current LP solution, see SCIProwGetDualsol(). If
+ *  parameter pricing/smoothing is positive, it is the convex combination of the dual value at the stability center and
+ *  the LP dual value with weight pricing/smoothing on the center. The center moves to the smoothed duals if the pricers
+ *  report a better lower bound with them, or in every round if no pricer reports a bound. If no pricer finds a
+ *  variable with the smoothed duals, SCIP calls the pricers again in the same round, and this method then returns the
+ *  LP dual values. Farkas pricing is not smoothed.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_Real SCIPgetRowPricingDualsol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW*             row                 /**< LP row */
+   )
+{
+   SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPgetRowPricingDualsol", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   return SCIPpricestoreGetRowDualsol(scip->pricestore, row);
+}
+
 /** sets the priority priority of a variable pricer */
 SCIP_RETCODE SCIPsetPricerPriority(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -42,6 +42,7 @@
 
 
 #include "scip/def.h"
+#include "scip/type_lp.h"
 #include "scip/type_pricer.h"
 #include "scip/type_result.h"
 #include "scip/type_retcode.h"
@@ -248,6 +249,39 @@ int SCIPgetNActivePricers(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns whether enough variables have been priced in the current pricing round, such that the remaining pricers of
+ *  the round are skipped
+ *
+ *  Pricers that solve several independent pricing subproblems can use this to stop after a subproblem and skip the
+ *  remaining ones (partial pricing), see parameter pricing/partialvars. Another pricing round follows as long as
+ *  variables are added, so the final LP bound remains valid.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPhasEnoughPricedVars(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+/** returns the dual value of an LP row that pricers should use in their reduced cost pricing
+ *
+ *  Without dual smoothing, this is the dual value of the row in the current LP solution, see SCIProwGetDualsol(). If
+ *  parameter pricing/smoothing is positive, it is the convex combination of the dual value at the stability center and
+ *  the LP dual value with weight pricing/smoothing on the center. The center moves to the smoothed duals if the pricers
+ *  report a better lower bound with them, or in every round if no pricer reports a bound. If no pricer finds a
+ *  variable with the smoothed duals, SCIP calls the pricers again in the same round, and this method then returns the
+ *  LP dual values. Farkas pricing is not smoothed.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_EXPORT
+SCIP_Real SCIPgetRowPricingDualsol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW*             row                 /**< LP row */
+   );
+
 /** sets the priority of a variable pricer */
 SCIP_EXPORT
 SCIP_RETCODE SCIPsetPricerPriority(
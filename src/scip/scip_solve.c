@@ -109,6 +109,7 @@
 #include "scip/struct_stat.h"
 #include "scip/struct_tree.h"
 #include "scip/syncstore.h"
+#include "scip/trace.h"
 #include "scip/tree.h"
 #include "scip/var.h"
 #include "scip/visual.h"
@@ -1455,6 +1456,29 @@ SCIP_RETCODE transformSols(
    return SCIP_OKAY;
 }
 
+/** finishes the trace of the solving process and writes it to the trace file, if requested */
+static
+SCIP_RETCODE exitTrace(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   const char* filename = NULL;
+
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+   assert(scip->set->time_tracefilename != NULL);
+
+   /* only the main SCIP and concurrent solvers record a trace; concurrent solvers run in their own threads and write
+    * to separate files
+    */
+   if( scip->set->time_tracefilename[0] != '-' || scip->set->time_tracefilename[1] != '\0' )
+      filename = scip->set->time_tracefilename;
+
+   SCIP_CALL( SCIPtraceExit(scip->stat->trace, scip->set, scip->messagehdlr, filename, scip->concurrent != NULL) );
+
+   return SCIP_OKAY;
+}
+
 /** initializes solution process data structures */
 static
 SCIP_RETCODE initSolve(
@@ -1510,6 +1534,9 @@ SCIP_RETCODE initSolve(
    /* possibly create visualization output file */
    SCIP_CALL( SCIPvisualInit(scip->stat->visual, scip->mem->probmem, scip->set, scip->messagehdlr) );
 
+   /* start tracing of solving process; sub-SCIPs inherit timing/trace, but are not traced to keep their memory small */
+   SCIP_CALL( SCIPtraceInit(scip->stat->trace, scip->set, scip->set->time_trace && scip->stat->subscipdepth == 0) );
+
    /* initialize solution process data structures */
    SCIP_CALL( SCIPpricestoreCreate(&scip->pricestore) );
    SCIP_CALL( SCIPsepastoreCreate(&scip->sepastore, scip->mem->probmem, scip->set) );
@@ -1679,6 +1706,12 @@ SCIP_RETCODE freeSolve(
    /* possibly close visualization output file */
    SCIPvisualExit(scip->stat->visual, scip->set, scip->messagehdlr);
 
+   /* finish tracing of solving process, but keep recording over restarts */
+   if( !restart )
+   {
+      SCIP_CALL( exitTrace(scip) );
+   }
+
    /* reset statistics for current branch and bound run */
    if( scip->stat->status == SCIP_STATUS_INFEASIBLE || scip->stat->status == SCIP_STATUS_OPTIMAL || scip->stat->status == SCIP_STATUS_UNBOUNDED || scip->stat->status == SCIP_STATUS_INFORUNBD )
       SCIPstatResetCurrentRun(scip->stat, scip->set, scip->transprob, scip->origprob, TRUE);
@@ -1779,6 +1812,9 @@ SCIP_RETCODE freeReoptSolve(
    /* possibly close visualization output file */
    SCIPvisualExit(scip->stat->visual, scip->set, scip->messagehdlr);
 
+   /* finish tracing of solving process */
+   SCIP_CALL( exitTrace(scip) );
+
    /* reset statistics for current branch and bound run */
    SCIPstatResetCurrentRun(scip->stat, scip->set, scip->transprob, scip->origprob, FALSE);
 
@@ -37,6 +37,8 @@
 #include "scip/def.h"
 #include "scip/set.h"
 #include "scip/stat.h"
+#include "scip/struct_stat.h"
+#include "scip/trace.h"
 #include "scip/clock.h"
 #include "scip/paramset.h"
 #include "scip/sepastore.h"
@@ -460,7 +462,9 @@ SCIP_RETCODE SCIPsepaExecLP(
          SCIPclockStart(sepa->sepaclock, set);
 
          /* call external separation method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( sepa->sepaexeclp(set->scip, sepa, result, allowlocal, depth) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_SEPA, sepa->name);
 
          /* stop timing */
          SCIPclockStop(sepa->sepaclock, set);
@@ -571,7 +575,9 @@ SCIP_RETCODE SCIPsepaExecSol(
          SCIPclockStart(sepa->sepaclock, set);
 
          /* call external separation method */
+         SCIPtraceBegin(stat->trace, set);
          SCIP_CALL( sepa->sepaexecsol(set->scip, sepa, sol, result, allowlocal, depth) );
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_SEPA, sepa->name);
 
          /* stop timing */
          SCIPclockStop(sepa->sepaclock, set);
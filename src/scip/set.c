@@ -161,6 +161,13 @@
 #define SCIP_DEFAULT_CONF_WEIGHTREPROPDEPTH 0.1 /**< weight of the repropagation depth of a conflict used in score calculation */
 #define SCIP_DEFAULT_CONF_WEIGHTVALIDDEPTH  1.0 /**< weight of the valid depth of a conflict used in score calculation */
 #define SCIP_DEFAULT_CONF_MINIMPROVE       0.05 /**< minimal improvement of primal bound to remove conflicts based on a previous incumbent */
+#define SCIP_DEFAULT_CONF_MINSUCCESSRATE   0.0  /**< minimal share of successful calls of a conflict analysis type below
+                                                 *   which it is only applied to every conflict/skipfreq-th conflict
+                                                 *   (0.0: always apply) */
+#define SCIP_DEFAULT_CONF_MINSUCCESSCALLS  100  /**< minimal number of calls of a conflict analysis type before its
+                                                 *   success rate is compared to conflict/minsuccessrate */
+#define SCIP_DEFAULT_CONF_SKIPFREQ          10  /**< frequency with which conflict analysis types that are below
+                                                 *   conflict/minsuccessrate are still applied */
 
 /* Conflict Analysis (dual ray) */
 
@@ -270,6 +277,7 @@
 
 #define SCIP_DEFAULT_NLP_SOLVER              "" /**< name of NLP solver to use, or "" if solver should be chosen by priority */
 #define SCIP_DEFAULT_NLP_DISABLE          FALSE /**< should the NLP be always disabled? */
+#define SCIP_DEFAULT_NLP_EXPRINTCACHESIZE 10000 /**< maximal number of expression structures cached by an expression interpreter */
 
 
 /* Memory */
@@ -355,10 +363,14 @@
                                                  *   found */
 #define SCIP_DEFAULT_PRICE_MAXVARS          100 /**< maximal number of variables priced in per pricing round */
 #define SCIP_DEFAULT_PRICE_MAXVARSROOT     2000 /**< maximal number of priced variables at the root node */
+#define SCIP_DEFAULT_PRICE_PARTIALVARS  INT_MAX /**< number of priced variables after which the remaining pricers of a
+                                                 *   pricing round are skipped (INT_MAX: only stop at maxvars) */
 #define SCIP_DEFAULT_PRICE_DELVARS        FALSE /**< should variables created at the current node be deleted when the node is solved
                                                  *   in case they are not present in the LP anymore? */
 #define SCIP_DEFAULT_PRICE_DELVARSROOT    FALSE /**< should variables created at the root node be deleted when the root is solved
                                                  *   in case they are not present in the LP anymore? */
+#define SCIP_DEFAULT_PRICE_SMOOTHING        0.0 /**< weight of the stability center in the dual values given to the pricers
+                                                 *   (0.0: no dual smoothing) */
 
 /* Decomposition */
 #define SCIP_DEFAULT_DECOMP_BENDERSLABELS FALSE /**< should the variables be labelled for the application of Benders' decomposition */
@@ -495,6 +507,9 @@
 #define SCIP_DEFAULT_TIME_RARECLOCKCHECK  FALSE /**< should clock checks of solving time be performed less frequently (might exceed time limit slightly) */
 #define SCIP_DEFAULT_TIME_STATISTICTIMING  TRUE /**< should timing for statistic output be enabled? */
 #define SCIP_DEFAULT_TIME_NLPIEVAL        FALSE /**< should time for evaluation in NLP solves be measured? */
+#define SCIP_DEFAULT_TIME_TRACE           FALSE /**< should the time spans of node processing and plugin calls be traced? */
+#define SCIP_DEFAULT_TIME_TRACEBUFFERSIZE 1000000 /**< maximal number of trace events that are kept */
+#define SCIP_DEFAULT_TIME_TRACEFILENAME     "-" /**< name of file to write trace to, or - if no trace should be written */
 
 
 /* visualization output */
@@ -1238,6 +1253,7 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->extcodessize = 0;
    (*set)->visual_vbcfilename = NULL;
    (*set)->visual_bakfilename = NULL;
+   (*set)->time_tracefilename = NULL;
    (*set)->nlp_solver = NULL;
    (*set)->nlp_disable = FALSE;
    (*set)->num_relaxfeastol = SCIP_INVALID;
@@ -1520,6 +1536,18 @@ SCIP_RETCODE SCIPsetCreate(
          "conflict/minimprove",
          "minimal improvement of primal bound to remove conflicts based on a previous incumbent",
          &(*set)->conf_minimprove, TRUE, SCIP_DEFAULT_CONF_MINIMPROVE, 0.0, 1.0, NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "conflict/minsuccessrate",
+         "minimal share of successful calls of a conflict analysis type below which it is only applied to every conflict/skipfreq-th conflict (0.0: always apply)",
+         &(*set)->conf_minsuccessrate, TRUE, SCIP_DEFAULT_CONF_MINSUCCESSRATE, 0.0, 1.0, NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "conflict/minsuccesscalls",
+         "minimal number of calls of a conflict analysis type before its success rate is compared to conflict/minsuccessrate",
+         &(*set)->conf_minsuccesscalls, TRUE, SCIP_DEFAULT_CONF_MINSUCCESSCALLS, 1, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "conflict/skipfreq",
+         "frequency with which conflict analysis types below conflict/minsuccessrate are still applied",
+         &(*set)->conf_skipfreq, TRUE, SCIP_DEFAULT_CONF_SKIPFREQ, 1, INT_MAX, NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "conflict/weightsize",
          "weight of the size of a conflict used in score calculation",
@@ -1895,6 +1923,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should the NLP relaxation be always disabled (also for NLPs/MINLPs)?",
          &(*set)->nlp_disable, FALSE, SCIP_DEFAULT_NLP_DISABLE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "nlp/exprintcachesize",
+         "maximal number of expression structures for which an expression interpreter caches its compiled data (0: no caching)",
+         &(*set)->nlp_exprintcachesize, TRUE, SCIP_DEFAULT_NLP_EXPRINTCACHESIZE, 0, INT_MAX,
+         NULL, NULL) );
 
    /* memory parameters */
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
@@ -2233,6 +2266,11 @@ SCIP_RETCODE SCIPsetCreate(
          "maximal number of priced variables at the root node",
          &(*set)->price_maxvarsroot, FALSE, SCIP_DEFAULT_PRICE_MAXVARSROOT, 1, INT_MAX,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "pricing/partialvars",
+         "number of priced variables after which the remaining pricers and pricing subproblems of a pricing round are skipped (INT_MAX: only stop at pricing/maxvars)",
+         &(*set)->price_partialvars, FALSE, SCIP_DEFAULT_PRICE_PARTIALVARS, 1, INT_MAX,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "pricing/abortfac",
          "pricing is aborted, if fac * pricing/maxvars pricing candidates were found",
@@ -2248,6 +2286,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should variables created at the root node be deleted when the root is solved in case they are not present in the LP anymore?",
          &(*set)->price_delvarsroot, FALSE, SCIP_DEFAULT_PRICE_DELVARSROOT,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "pricing/smoothing",
+         "weight of the stability center in the dual values of SCIPgetRowPricingDualsol() (0.0: no dual smoothing)",
+         &(*set)->price_smoothing, FALSE, SCIP_DEFAULT_PRICE_SMOOTHING, 0.0, 0.99,
+         NULL, NULL) );
 
    /* Decomposition parameters */
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
@@ -2669,6 +2712,21 @@ SCIP_RETCODE SCIPsetCreate(
          "should time for evaluation in NLP solves be measured?",
          &(*set)->time_nlpieval, FALSE, SCIP_DEFAULT_TIME_NLPIEVAL,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "timing/trace",
+         "should the time spans of node processing and plugin calls be traced (sub-SCIPs are not traced)?",
+         &(*set)->time_trace, FALSE, SCIP_DEFAULT_TIME_TRACE,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "timing/tracebuffersize",
+         "maximal number of trace events that are kept (the oldest events are dropped first)",
+         &(*set)->time_tracebuffersize, TRUE, SCIP_DEFAULT_TIME_TRACEBUFFERSIZE, 1, INT_MAX,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
+         "timing/tracefilename",
+         "name of file to write the trace to at the end of solving in Chrome trace event format, or - if no trace should be written",
+         &(*set)->time_tracefilename, FALSE, SCIP_DEFAULT_TIME_TRACEFILENAME,
+         NULL, NULL) );
 
    /* visualization parameters */
    SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
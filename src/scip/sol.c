@@ -1850,6 +1850,7 @@ SCIP_RETCODE SCIPsolCheck(
    SCIP_Bool*            feasible            /**< stores whether solution is feasible */
    )
 {
+   SCIP_CONSHDLR* firstconshdlr;
    SCIP_RESULT result;
    int h;
 
@@ -1936,13 +1937,41 @@ SCIP_RETCODE SCIPsolCheck(
       }
    }
 
+   /* start with the constraint handler that rejected the last infeasible solution, since candidate solutions often
+    * violate the same constraints; this is only done for constraint handlers whose check does not depend on the order
+    */
+   firstconshdlr = NULL;
+   if( *feasible && !printreason && stat->lastcheckconshdlr != NULL )
+   {
+      firstconshdlr = stat->lastcheckconshdlr;
+      assert(SCIPconshdlrHasIndependentCheck(firstconshdlr));
+
+      SCIP_CALL( SCIPconshdlrCheck(firstconshdlr, blkmem, set, stat, sol,
+            checkintegrality, checklprows, printreason, completely, &result) );
+      *feasible = (result == SCIP_FEASIBLE);
+
+#ifdef SCIP_DEBUG
+      if( !(*feasible) )
+      {
+         SCIPdebugPrintf("  -> infeasibility detected in constraint handler <%s>\n", SCIPconshdlrGetName(firstconshdlr));
+      }
+#endif
+   }
+
    /* check whether the solution fulfills all constraints */
    for( h = 0; h < set->nconshdlrs && (*feasible || completely); ++h )
    {
+      if( set->conshdlrs[h] == firstconshdlr )
+         continue;
+
       SCIP_CALL( SCIPconshdlrCheck(set->conshdlrs[h], blkmem, set, stat, sol,
             checkintegrality, checklprows, printreason, completely, &result) );
       *feasible = *feasible && (result == SCIP_FEASIBLE);
 
+      /* remember the constraint handler to start the next check with */
+      if( result != SCIP_FEASIBLE && SCIPconshdlrHasIndependentCheck(set->conshdlrs[h]) )
+         stat->lastcheckconshdlr = set->conshdlrs[h];
+
 #ifdef SCIP_DEBUG
       if( !(*feasible) )
       {
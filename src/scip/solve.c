@@ -86,6 +86,7 @@
 #include "scip/struct_tree.h"
 #include "scip/struct_var.h"
 #include "scip/syncstore.h"
+#include "scip/trace.h"
 #include "scip/tree.h"
 #include "scip/var.h"
 #include "scip/visual.h"
@@ -360,9 +361,16 @@ SCIP_RETCODE SCIPprimalHeuristics(
       }
 #endif
 
+      SCIPtraceBegin(stat->trace, set);
       SCIP_CALL( SCIPheurExec(set->heurs[h], set, primal, depth, lpstateforkdepth, heurtiming, nodeinfeasible,
             &ndelayedheurs, &result) );
 
+      /* only record heuristics that were actually called */
+      if( result == SCIP_DIDNOTRUN || result == SCIP_DELAYED )
+         SCIPtraceCancel(stat->trace, set);
+      else
+         SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_HEUR, SCIPheurGetName(set->heurs[h]));
+
 #ifndef NDEBUG
       if( BMSgetNUsedBufferMemory(SCIPbuffer(set->scip)) > nusedbuffer )
       {
@@ -2150,6 +2158,12 @@ SCIP_RETCODE SCIPpriceLoop(
    if( maxpricerounds == -1 )
       maxpricerounds = INT_MAX;
 
+   /* the pricers query the maximal number of variables of this loop via SCIPhasEnoughPricedVars() */
+   SCIPpricestoreSetPretendRoot(pricestore, pretendroot);
+
+   /* the stability center of dual smoothing is kept over the pricing loops of the same node */
+   SCIPpricestoreStartSmoothing(pricestore, SCIPnodeGetNumber(currentnode));
+
    /* pricing (has to be done completely to get a valid lower bound) */
    npricerounds = 0;
    while( !(*lperror) && mustprice && npricerounds < maxpricerounds )
@@ -2157,9 +2171,11 @@ SCIP_RETCODE SCIPpriceLoop(
       SCIP_Bool enoughvars;
       SCIP_RESULT result;
       SCIP_Real lb;
+      SCIP_Real roundlb;
       SCIP_Bool foundsol;
       SCIP_Bool stopearly;
       SCIP_Bool stoppricing;
+      SCIP_Bool mispriced;
       int p;
 
       assert(lp->flushed);
@@ -2194,32 +2210,61 @@ SCIP_RETCODE SCIPpriceLoop(
       /* sort pricer algorithms by priority */
       SCIPsetSortPricers(set);
 
+      /* with dual smoothing, the pricers first use a convex combination of the stability center and the LP duals;
+       * Farkas pricing always uses the dual ray of the LP
+       */
+      SCIPpricestoreSetSmoothing(pricestore, SCIPlpGetSolstat(lp) == SCIP_LPSOLSTAT_INFEASIBLE ? 0.0 : set->price_smoothing);
+
       /* call external pricer algorithms, that are active for the current problem */
-      enoughvars = (SCIPsetGetPriceMaxvars(set, pretendroot) == INT_MAX ?
-            FALSE : SCIPpricestoreGetNVars(pricestore) >= SCIPsetGetPriceMaxvars(set, pretendroot) + 1);
-      stoppricing = FALSE;
-      for( p = 0; p < set->nactivepricers && !enoughvars; ++p )
+      do
       {
-         SCIP_CALL( SCIPpricerExec(set->pricers[p], set, transprob, lp, pricestore, &lb, &stopearly, &result) );
-         assert(result == SCIP_DIDNOTRUN || result == SCIP_SUCCESS);
-         SCIPsetDebugMsg(set, "pricing: pricer %s returned result = %s, lowerbound = %f\n",
-            SCIPpricerGetName(set->pricers[p]), (result == SCIP_DIDNOTRUN ? "didnotrun" : "success"), lb);
-         enoughvars = enoughvars || (SCIPsetGetPriceMaxvars(set, pretendroot) == INT_MAX ?
-               FALSE : SCIPpricestoreGetNVars(pricestore) >= SCIPsetGetPriceMaxvars(set, pretendroot) + 1);
-         *aborted = ( (*aborted) || (result == SCIP_DIDNOTRUN) );
-
-         /* set stoppricing to TRUE, if the first pricer wants to stop pricing */
-         if( p == 0 && stopearly )
-            stoppricing = TRUE;
-
-         /* stoppricing only remains TRUE, if all other pricers want to stop pricing as well */
-         if( stoppricing && !stopearly )
-            stoppricing = FALSE;
-
-         /* update lower bound w.r.t. the lower bound given by the pricer */
-         SCIPnodeUpdateLowerbound(currentnode, stat, set, tree, transprob, origprob, lb);
-         SCIPsetDebugMsg(set, " -> new lower bound given by pricer %s: %g\n", SCIPpricerGetName(set->pricers[p]), lb);
+         roundlb = -SCIPsetInfinity(set);
+         enoughvars = SCIPpricestoreHasEnoughVars(pricestore, set);
+         stoppricing = FALSE;
+         for( p = 0; p < set->nactivepricers && !enoughvars; ++p )
+         {
+            SCIP_CALL( SCIPpricerExec(set->pricers[p], set, transprob, lp, pricestore, &lb, &stopearly, &result) );
+            assert(result == SCIP_DIDNOTRUN || result == SCIP_SUCCESS);
+            SCIPsetDebugMsg(set, "pricing: pricer %s returned result = %s, lowerbound = %f\n",
+               SCIPpricerGetName(set->pricers[p]), (result == SCIP_DIDNOTRUN ? "didnotrun" : "success"), lb);
+            enoughvars = enoughvars || SCIPpricestoreHasEnoughVars(pricestore, set);
+            *aborted = ( (*aborted) || (result == SCIP_DIDNOTRUN) );
+
+            /* set stoppricing to TRUE, if the first pricer wants to stop pricing */
+            if( p == 0 && stopearly )
+               stoppricing = TRUE;
+
+            /* stoppricing only remains TRUE, if all other pricers want to stop pricing as well */
+            if( stoppricing && !stopearly )
+               stoppricing = FALSE;
+
+            /* update lower bound w.r.t. the lower bound given by the pricer */
+            SCIPnodeUpdateLowerbound(currentnode, stat, set, tree, transprob, origprob, lb);
+            SCIPsetDebugMsg(set, " -> new lower bound given by pricer %s: %g\n", SCIPpricerGetName(set->pricers[p]), lb);
+            roundlb = MAX(roundlb, lb);
+         }
+
+         if( SCIPsetIsPositive(set, set->price_smoothing) && SCIPlpGetSolstat(lp) != SCIP_LPSOLSTAT_INFEASIBLE )
+         {
+            /* the smoothed duals become the next stability center if they gave a better bound */
+            SCIP_CALL( SCIPpricestoreUpdateSmoothingCenter(pricestore, set, lp, roundlb) );
+
+            /* if the smoothed duals did not yield a variable (mispricing), only the LP duals can prove that the LP is
+             * optimal, so the pricers are called again with them
+             */
+            mispriced = SCIPpricestoreIsSmoothing(pricestore) && SCIPpricestoreGetNVars(pricestore) == 0 && !stoppricing;
+            if( mispriced )
+            {
+               SCIPsetDebugMsg(set, "pricing: mispricing with smoothed duals, price again with LP duals\n");
+               SCIPpricestoreIncNMispricings(pricestore);
+               SCIPpricestoreSetSmoothing(pricestore, 0.0);
+            }
+         }
+         else
+            mispriced = FALSE;
       }
+      while( mispriced );
+      SCIPpricestoreSetSmoothing(pricestore, 0.0);
 
       /* apply the priced variables to the LP */
       SCIP_CALL( SCIPpricestoreApplyVars(pricestore, blkmem, set, stat, eventqueue, transprob, tree, lp) );
@@ -5104,9 +5149,11 @@ SCIP_RETCODE SCIPsolveCIP(
       SCIP_CALL( SCIPeventProcess(&event, set, NULL, NULL, NULL, eventfilter) );
 
       /* solve focus node */
+      SCIPtraceBegin(stat->trace, set);
       SCIP_CALL( solveNode(blkmem, set, messagehdlr, stat, mem, origprob, transprob, primal, tree, reopt, lp, relaxation,
             pricestore, sepastore, branchcand, cutpool, delayedcutpool, conflict, conflictstore, eventfilter, eventqueue,
             cliquetable, &cutoff, &postpone, &unbounded, &infeasible, restart, &afternodeheur, &stopped) );
+      SCIPtraceEnd(stat->trace, set, SCIP_TRACECAT_NODE, "node");
       assert(!cutoff || infeasible);
       assert(BMSgetNUsedBufferMemory(mem->buffer) == 0);
       assert(SCIPtreeGetCurrentNode(tree) == focusnode);
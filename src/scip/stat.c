@@ -46,6 +46,7 @@
 #include "scip/stat.h"
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
+#include "scip/trace.h"
 #include "scip/var.h"
 #include "scip/visual.h"
 
@@ -94,6 +95,7 @@ SCIP_RETCODE SCIPstatCreate(
    SCIP_CALL( SCIPhistoryCreate(&(*stat)->glbhistory, blkmem) );
    SCIP_CALL( SCIPhistoryCreate(&(*stat)->glbhistorycrun, blkmem) );
    SCIP_CALL( SCIPvisualCreate(&(*stat)->visual, messagehdlr) );
+   SCIP_CALL( SCIPtraceCreate(&(*stat)->trace) );
 
    SCIP_CALL( SCIPregressionCreate(&(*stat)->regressioncandsobjval) );
 
@@ -144,6 +146,7 @@ SCIP_RETCODE SCIPstatFree(
    SCIPhistoryFree(&(*stat)->glbhistory, blkmem);
    SCIPhistoryFree(&(*stat)->glbhistorycrun, blkmem);
    SCIPvisualFree(&(*stat)->visual);
+   SCIPtraceFree(&(*stat)->trace);
 
    SCIPregressionFree(&(*stat)->regressioncandsobjval);
 
@@ -302,6 +305,7 @@ void SCIPstatReset(
    stat->solindex = 0;
    stat->memsavemode = FALSE;
    stat->nnodesbeforefirst = -1;
+   stat->lastcheckconshdlr = NULL;
    stat->ninitconssadded = 0;
    stat->nactiveconssadded = 0;
    stat->externmemestim = 0;
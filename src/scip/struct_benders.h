@@ -38,6 +38,8 @@
 #include "scip/type_clock.h"
 #include "scip/type_benders.h"
 #include "scip/type_benderscut.h"
+#include "scip/type_cons.h"
+#include "scip/type_lp.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,6 +55,32 @@ struct SCIP_BenderscutCut
 };
 typedef struct SCIP_BenderscutCut SCIP_BENDERSCUTCUT;
 
+/** compact representation of a recently added cut, used to detect near-duplicate cuts */
+struct SCIP_BendersDedupCut
+{
+   SCIP_ROW*             row;                /**< the row of the added cut, or NULL if the cut was added as constraint */
+   SCIP_CONS*            cons;               /**< the constraint of the added cut, or NULL if the cut was added as row */
+   int*                  varinds;            /**< the indices of the variables in the cut, sorted non-decreasingly */
+   SCIP_Real*            vals;               /**< the coefficients of the cut, scaled to unit euclidean norm */
+   SCIP_Real             lhs;                /**< the left hand side of the cut, scaled by the same factor as vals */
+   int                   nvars;              /**< the number of variables in the cut */
+};
+typedef struct SCIP_BendersDedupCut SCIP_BENDERSDEDUPCUT;
+
+/** sum of the optimality cuts vals * vars >= lhs of a block of subproblems, added as a single cut */
+struct SCIP_BendersAggrCut
+{
+   SCIP_VAR**            vars;               /**< the variables of the aggregated cut */
+   SCIP_Real*            vals;               /**< the coefficients of the variables in the aggregated cut */
+   SCIP_HASHMAP*         varpos;             /**< map from the variables to their positions in the vars array */
+   SCIP_Real             lhs;                /**< the left hand side of the aggregated cut */
+   int                   nvars;              /**< the number of variables in the aggregated cut */
+   int                   varssize;           /**< the size of the vars and vals arrays */
+   int                   ncuts;              /**< the number of cuts that were aggregated since the last cut was added */
+   SCIP_Bool             addcut;             /**< should the aggregated cut be added as a row instead of a constraint? */
+};
+typedef struct SCIP_BendersAggrCut SCIP_BENDERSAGGRCUT;
+
 /** Benders' decomposition data */
 struct SCIP_Benders
 {
@@ -173,6 +201,21 @@ struct SCIP_Benders
    int                   storedcutssize;     /**< the size of the added cuts array */
    int                   nstoredcuts;        /**< the number of the added cuts */
 
+   /* cut deduplication information */
+   SCIP_BENDERSDEDUPCUT** dedupcuts;         /**< rotating memory of recently added cuts used for duplicate detection */
+   int                   dedupcutssize;      /**< the size of the rotating memory */
+   int                   ndedupcuts;         /**< the number of cuts in the rotating memory */
+   int                   dedupcutspos;       /**< the position in the rotating memory that is replaced next */
+   int                   ndupcuts;           /**< the number of generated cuts that were identified as duplicates */
+   SCIP_Bool             dedupcutsenabled;   /**< should near-duplicate cuts be detected and replaced by previous cuts? */
+   int                   dedupmemsize;       /**< the maximal number of recently added cuts kept for duplicate detection */
+   SCIP_Real             dedupmaxparall;     /**< minimal parallelism for a cut to be considered a duplicate of a previous cut */
+
+   /* cut aggregation information */
+   SCIP_BENDERSAGGRCUT** aggrcuts;           /**< the aggregated optimality cuts for each block of subproblems */
+   int                   naggrcuts;          /**< the number of blocks of subproblems, i.e. the size of aggrcuts */
+   int                   cutaggrsize;        /**< the number of subproblems whose optimality cuts are aggregated (1: no aggregation) */
+   int                   naggregatedcuts;    /**< the number of aggregated cuts that were added */
 };
 
 /** statistics for solving the subproblems. Used for prioritising the solving of the subproblem */
@@ -155,6 +155,10 @@ struct SCIP_Conflict
    SCIP_Longint          nsbiterations;      /**< total number of LP iterations used in strong branching conflict analysis */
    SCIP_Longint          npseudocalls;       /**< number of calls to pseudo solution conflict analysis */
    SCIP_Longint          npseudosuccess;     /**< number of calls yielding at least one conflict constraint */
+   SCIP_Longint          npropskipped;       /**< number of skipped calls to unproductive propagation conflict analysis */
+   SCIP_Longint          ninflpskipped;      /**< number of skipped calls to unproductive infeasible LP conflict analysis */
+   SCIP_Longint          nboundlpskipped;    /**< number of skipped calls to unproductive bound exceeding LP conflict analysis */
+   SCIP_Longint          npseudoskipped;     /**< number of skipped calls to unproductive pseudo solution conflict analysis */
    SCIP_Longint          npseudoconfconss;   /**< number of valid conflict constraints detected in pseudo sol conflict analysis */
    SCIP_Longint          npseudoconfliterals;/**< total number of literals in valid pseudo solution conflict constraints */
    SCIP_Longint          npseudoreconvconss; /**< number of reconvergence constraints detected in pseudo sol conflict analysis */
@@ -277,6 +277,8 @@ struct SCIP_Conshdlr
    SCIP_Bool             delaysepa;          /**< should separation method be delayed, if other separators found cuts? */
    SCIP_Bool             delayprop;          /**< should propagation method be delayed, if other propagators found reductions? */
    SCIP_Bool             needscons;          /**< should the constraint handler be skipped, if no constraints are available? */
+   SCIP_Bool             independentcheck;   /**< is the feasibility check independent of the order in which the constraint
+                                              *   handlers are checked? */
    SCIP_Bool             sepalpwasdelayed;   /**< was the LP separation method delayed at the last call? */
    SCIP_Bool             sepasolwasdelayed;  /**< was the SOL separation method delayed at the last call? */
    SCIP_Bool             propwasdelayed;     /**< was the propagation method delayed at the last call? */
@@ -225,4 +225,40 @@ struct SCIP_ExprIter
    unsigned int          stopstages;         /**< stages in which to interrupt iterator */
 };
 
+/** instruction of an expression evaluation tape
+ *
+ * Each instruction computes the value of one expression of the DAG. The value is stored in the slot with the same
+ * index as the instruction, the arguments are given as indices of slots of earlier instructions.
+ */
+struct SCIP_ExprTapeInstr
+{
+   SCIP_EXPR*            expr;               /**< expression that is evaluated by this instruction */
+   SCIP_EXPRTAPE_OPCODE  opcode;             /**< operation code */
+   SCIP_Real             coef;               /**< value (VALUE), constant (SUM), coefficient (PRODUCT), exponent (POW, SIGNPOWER) */
+   int                   firstarg;           /**< position of the first argument in the argument arrays of the tape */
+   int                   nargs;              /**< number of arguments (equals the number of children of expr) */
+   int                   varidx;             /**< index of variable in the variables array of the tape (VAR only), or -1 */
+};
+
+/** expression evaluation tape
+ *
+ * A flat sequence of instructions in topological order that evaluates an expression DAG without walking it with an
+ * expression iterator.
+ */
+struct SCIP_ExprTape
+{
+   BMS_BLKMEM*           blkmem;             /**< block memory */
+   SCIP_EXPR*            root;               /**< root expression of the tape (captured) */
+   SCIP_EXPRTAPEINSTR*   instrs;             /**< instructions in topological order, the last one evaluates the root */
+   int                   ninstrs;            /**< number of instructions */
+   int*                  args;               /**< slot indices of the arguments of all instructions */
+   SCIP_Real*            argcoefs;           /**< coefficients of the arguments of sums (1.0 for other instructions) */
+   int                   nargs;              /**< total number of arguments */
+   SCIP_VAR**            vars;               /**< distinct variables of the expression, in order of first occurrence */
+   int                   nvars;              /**< number of distinct variables */
+   SCIP_Real*            varvals;            /**< work array for the values of the variables */
+   SCIP_Real*            slotvals;           /**< work array for the values of the instructions */
+   SCIP_Real*            slotadjs;           /**< work array for the adjoints of the instructions */
+};
+
 #endif /* SCIP_STRUCT_EXPR_H_ */
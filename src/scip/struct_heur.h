@@ -138,6 +138,25 @@ struct SCIP_VGraph
    int*                  varconssize;        /**< size array for every varconss entry */
 };
 
+/** working solution of a local search heuristic with incrementally updated activities of the LP rows
+ *
+ *  Changing the value of a variable updates the activities of the rows in its column, so that the feasibility of the
+ *  working solution for the LP rows is known after each move. Changed rows are recomputed before the solution is tried,
+ *  which allows to skip the rows of the LP in the final feasibility check.
+ */
+struct SCIP_CheckedSol
+{
+   SCIP_SOL*             sol;                /**< working solution */
+   SCIP_Real*            activities;         /**< activities of the LP rows in the working solution */
+   SCIP_Bool*            violated;           /**< is the LP row violated by the working solution? */
+   SCIP_Bool*            changed;            /**< was the activity of the LP row updated incrementally? */
+   int*                  changedrows;        /**< positions of the LP rows with incrementally updated activities */
+   int                   nchangedrows;       /**< number of LP rows with incrementally updated activities */
+   int                   nviolrows;          /**< number of global LP rows violated by the working solution */
+   int                   nviollocalrows;     /**< number of local LP rows violated by the working solution */
+   int                   nlprows;            /**< number of LP rows */
+};
+
 #ifdef __cplusplus
 }
 #endif
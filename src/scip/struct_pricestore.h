@@ -52,16 +52,26 @@ struct SCIP_Pricestore
    SCIP_VAR**            bdviolvars;         /**< variables where zero violates the bounds */
    SCIP_Real*            bdviolvarslb;       /**< lower bounds of bdviolvars */
    SCIP_Real*            bdviolvarsub;       /**< upper bounds of bdbiolvars */
+   SCIP_Real*            centerduals;        /**< dual values of the LP rows at the stability center of dual smoothing */
+   int*                  centerrowidx;       /**< indices of the LP rows the center duals belong to, by LP position */
+   SCIP_Real             centerbound;        /**< lower bound reported by the pricers at the stability center */
+   SCIP_Real             smoothing;          /**< smoothing factor of the dual values in the current pricing round */
+   SCIP_Longint          centernode;         /**< number of the node the stability center belongs to */
    int                   varssize;           /**< size of vars and score arrays */
    int                   nvars;              /**< number of priced variables (max. is set->price_maxvars) */
    int                   bdviolvarssize;     /**< size of bdviolvars, bdviolvarslb, and bdviolvarsub arrays */
    int                   nbdviolvars;        /**< number of variables, where zero violates the bounds */
+   int                   centersize;         /**< size of centerduals and centerrowidx arrays */
+   int                   ncenterrows;        /**< number of LP rows with a dual value at the stability center */
+   int                   nmispricings;       /**< number of pricing rounds repeated with the LP duals after dual smoothing
+                                              *   found no variable */
    int                   naddedbdviolvars;   /**< number of bound violated variables already added to the LP */
    int                   nprobpricings;      /**< total number of calls to problem variable pricing */
    int                   nprobvarsfound;     /**< total number of problem variables, that were added (and possibly thrown away) */
    int                   nvarsfound;         /**< total number of variables, that were added (and possibly thrown away) */
    int                   nvarsapplied;       /**< total number of variables, that were added to the LP */
    SCIP_Bool             initiallp;          /**< is the pricing storage currently being filled with the initial LP columns? */
+   SCIP_Bool             pretendroot;        /**< are the pricers of the current pricing loop called as if we are at the root? */
 };
 
 #ifdef __cplusplus
@@ -278,6 +278,12 @@ struct SCIP_Set
                                               *   a previous incumbent.
                                               */
    SCIP_Bool             conf_uselocalrows;  /**< use local rows to construct infeasibility proofs */
+   SCIP_Real             conf_minsuccessrate;/**< minimal share of successful calls of a conflict analysis type below which it is
+                                              *   only applied to every conf_skipfreq-th conflict (0.0: always apply) */
+   int                   conf_minsuccesscalls;/**< minimal number of calls of a conflict analysis type before its success rate
+                                              *   is compared to conf_minsuccessrate */
+   int                   conf_skipfreq;      /**< frequency with which conflict analysis types below conf_minsuccessrate are
+                                              *   still applied */
 
    /* constraint settings */
    int                   cons_agelimit;      /**< maximum age an unnecessary constraint can reach before it is deleted
@@ -377,6 +383,7 @@ struct SCIP_Set
    /* NLP settings */
    SCIP_Bool             nlp_disable;        /**< should the NLP be disabled even if a constraint handler enabled it? */
    char*                 nlp_solver;         /**< name of NLP solver to use */
+   int                   nlp_exprintcachesize;/**< maximal number of expression structures cached by an expression interpreter */
 
    /* memory settings */
    SCIP_Real             mem_savefac;        /**< fraction of maximal memory usage resulting in switch to memory saving mode */
@@ -466,8 +473,12 @@ struct SCIP_Set
 
    /* pricing settings */
    SCIP_Real             price_abortfac;     /**< pricing is aborted, if fac * maxpricevars pricing candidates were found */
+   SCIP_Real             price_smoothing;    /**< weight of the stability center in the dual values given to the pricers
+                                              *   (0.0: no dual smoothing) */
    int                   price_maxvars;      /**< maximal number of variables priced in per pricing round */
    int                   price_maxvarsroot;  /**< maximal number of priced variables at the root node */
+   int                   price_partialvars;  /**< number of priced variables after which the remaining pricers of a
+                                              *   pricing round are skipped (INT_MAX: only stop at maxvars) */
    SCIP_Bool             price_delvars;      /**< should variables created at the current node be deleted when the node is solved
                                               *   in case they are not present in the LP anymore? */
    SCIP_Bool             price_delvarsroot;  /**< should variables created at the root node be deleted when the root is solved
@@ -602,6 +613,9 @@ struct SCIP_Set
    SCIP_Bool             time_rareclockcheck;/**< should clock checks of solving time be performed less frequently (might exceed time limit slightly) */
    SCIP_Bool             time_statistictiming;  /**< should timing for statistic output be enabled? */
    SCIP_Bool             time_nlpieval;      /**< should time for evaluation in NLP solves be measured? */
+   SCIP_Bool             time_trace;         /**< should the time spans of node processing and plugin calls be traced? */
+   int                   time_tracebuffersize; /**< maximal number of trace events that are kept */
+   char*                 time_tracefilename; /**< name of file to write trace to at the end of solving, or - if no trace should be written */
 
    /* tree compression parameters (for reoptimization) */
    SCIP_Bool             compr_enable;       /**< should automatic tree compression after presolving be enabled? (only for reoptimization) */
@@ -43,6 +43,7 @@
 #include "scip/def.h"
 #include "scip/type_stat.h"
 #include "scip/type_clock.h"
+#include "scip/type_trace.h"
 #include "scip/type_visual.h"
 #include "scip/type_history.h"
 #include "scip/type_var.h"
@@ -50,6 +51,7 @@
 #include "scip/type_heur.h"
 #include "scip/type_relax.h"
 #include "scip/type_misc.h"
+#include "scip/type_cons.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -181,7 +183,10 @@ struct SCIP_Stat
    SCIP_HISTORY*         glbhistory;         /**< global history information over all variables */
    SCIP_HISTORY*         glbhistorycrun;     /**< global history information over all variables for current run */
    SCIP_VAR*             lastbranchvar;      /**< last variable, that was branched on */
+   SCIP_CONSHDLR*        lastcheckconshdlr;  /**< constraint handler with independent check that rejected the last infeasible
+                                              *   solution, or NULL */
    SCIP_VISUAL*          visual;             /**< visualization information */
+   SCIP_TRACE*           trace;              /**< trace of the solving process */
    SCIP_HEUR*            firstprimalheur;    /**< heuristic which found the first primal solution */
    SCIP_STATUS           status;             /**< SCIP solving status */
    SCIP_BRANCHDIR        lastbranchdir;      /**< direction of the last branching */
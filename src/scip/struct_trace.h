@@ -0,0 +1,75 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   struct_trace.h
+ * @ingroup INTERNALAPI
+ * @brief  data structures for tracing of the solving process
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_STRUCT_TRACE_H__
+#define __SCIP_STRUCT_TRACE_H__
+
+#include "scip/def.h"
+#include "scip/type_clock.h"
+#include "scip/type_trace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** maximal nesting depth of trace events that are recorded */
+#define SCIP_TRACE_MAXDEPTH 64
+
+/** trace event, that is, a timed span of the solving process */
+struct SCIP_TraceEvent
+{
+   const char*           name;               /**< name of event, usually the name of a plugin; must not be freed before the trace is written */
+   SCIP_Real             start;              /**< start time of event in seconds */
+   SCIP_Real             duration;           /**< duration of event in seconds */
+   SCIP_TRACECAT         cat;                /**< category of event */
+};
+
+/** trace of the solving process
+ *
+ * The events are stored in a ring buffer, so that only the most recent events are kept if the buffer is full.
+ */
+struct SCIP_Trace
+{
+   SCIP_CLOCK*           clock;              /**< wall clock that gives the time stamps of the events */
+   SCIP_TRACEEVENT*      events;             /**< ring buffer of events, or NULL if not allocated yet */
+   int                   eventssize;         /**< size of events array */
+   SCIP_Longint          nevents;            /**< total number of recorded events, including overwritten ones */
+   SCIP_Real             starts[SCIP_TRACE_MAXDEPTH]; /**< start times of currently open events */
+   int                   depth;              /**< number of currently open events */
+   SCIP_Bool             active;             /**< are events recorded in the current solving process? */
+   int                   threadnum;          /**< number of the thread that the trace is recorded in */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -84,7 +84,6 @@ struct SCIP_InferenceData
       SCIP_CONS*         cons;               /**< constraint that inferred this bound change, or NULL */
       SCIP_PROP*         prop;               /**< propagator that inferred this bound change, or NULL */
    } reason;
-   int                   info;               /**< user information for inference to help resolving the conflict */
 };
 
 /** change in one bound of a variable */
@@ -97,6 +96,7 @@ struct SCIP_BoundChg
       SCIP_INFERENCEDATA inferencedata;      /**< data for inferred bound changes */
    } data;
    SCIP_VAR*             var;                /**< active variable to change the bounds for */
+   int                   inferinfo;          /**< user information for inference to help resolving the conflict */
    unsigned int          boundchgtype:2;     /**< bound change type: branching decision or inferred bound change */
    unsigned int          boundtype:1;        /**< type of bound for var: lower or upper bound */
    unsigned int          inferboundtype:1;   /**< type of bound for inference var (see inference data): lower or upper bound */
@@ -119,6 +119,7 @@ struct SCIP_BdChgInfo
    SCIP_VAR*             var;                /**< active variable that changed the bounds */
    SCIP_INFERENCEDATA    inferencedata;      /**< data for inferred bound changes */
    SCIP_BDCHGIDX         bdchgidx;           /**< bound change index in path from root to current node */
+   int                   inferinfo;          /**< user information for inference to help resolving the conflict */
    unsigned int          pos:27;             /**< position in the variable domain change array */
    unsigned int          boundchgtype:2;     /**< bound change type: branching decision or inferred bound change */
    unsigned int          boundtype:1;        /**< type of bound for var: lower or upper bound */
@@ -126,12 +127,15 @@ struct SCIP_BdChgInfo
    unsigned int          redundant:1;        /**< does the bound change info belong to a redundant bound change? */
 };
 
-/** tracks changes of the variables' domains (static arrays, bound changes only) */
+/** tracks changes of the variables' domains (static arrays, bound changes only)
+ *
+ *  The bound changes are stored in the same memory block directly behind this structure.
+ */
 struct SCIP_DomChgBound
 {
    unsigned int          nboundchgs:30;      /**< number of bound changes (must be first structure entry!) */
    unsigned int          domchgtype:2;       /**< type of domain change data (must be first structure entry!) */
-   SCIP_BOUNDCHG*        boundchgs;          /**< array with changes in bounds of variables */
+   SCIP_BOUNDCHG*        boundchgs;          /**< array with changes in bounds of variables, directly behind this structure */
 };
 
 /** tracks changes of the variables' domains (static arrays, bound and hole changes) */
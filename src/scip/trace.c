@@ -0,0 +1,312 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   trace.c
+ * @ingroup OTHER_CFILES
+ * @brief  methods for tracing the solving process and exporting traces in the Chrome trace event format
+ *
+ * If the parameter timing/trace is enabled, then the time spans of the node processing, LP solves, and the calls of
+ * separators, propagators, heuristics, constraint enforcement, and branching rules are recorded. The events are
+ * stored in a ring buffer of fixed size, so that tracing needs a constant amount of memory and only the most recent
+ * events are kept. At the end of the solving process, the events can be written in the Chrome trace event format
+ * (JSON), which can be viewed with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Each SCIP instance records its own trace. Concurrent solvers run in their own threads and write their traces to
+ * separate files, which use the thread number as thread id. Sub-SCIPs are not traced.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+#include <assert.h>
+
+#include "blockmemshell/memory.h"
+#include "scip/clock.h"
+#include "scip/message.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/set.h"
+#include "scip/struct_set.h"
+#include "scip/struct_trace.h"
+#include "scip/trace.h"
+#include "tpi/tpi.h"
+
+/** names of trace event categories */
+static const char* tracecatnames[] = { "node", "lp", "sepa", "prop", "heur", "consenfo", "branch" };
+
+/** prints a string as JSON string, escaping quotes and backslashes */
+static
+void printJSONString(
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   FILE*                 file,               /**< output file */
+   const char*           str                 /**< string to print */
+   )
+{
+   char buf[SCIP_MAXSTRLEN];
+   int pos = 0;
+
+   assert(str != NULL);
+
+   buf[pos++] = '"';
+   for( ; *str != '\0' && pos < SCIP_MAXSTRLEN - 3; ++str )
+   {
+      if( *str == '"' || *str == '\\' )
+         buf[pos++] = '\\';
+      buf[pos++] = *str;
+   }
+   buf[pos++] = '"';
+   buf[pos] = '\0';
+
+   SCIPmessageFPrintInfo(messagehdlr, file, "%s", buf);
+}
+
+/** creates trace data structure */
+SCIP_RETCODE SCIPtraceCreate(
+   SCIP_TRACE**          trace               /**< pointer to store the trace */
+   )
+{
+   assert(trace != NULL);
+
+   SCIP_ALLOC( BMSallocMemory(trace) );
+
+   SCIP_CALL( SCIPclockCreate(&(*trace)->clock, SCIP_CLOCKTYPE_WALL) );
+   (*trace)->events = NULL;
+   (*trace)->eventssize = 0;
+   (*trace)->nevents = 0;
+   (*trace)->depth = 0;
+   (*trace)->threadnum = 0;
+   (*trace)->active = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** frees trace data structure */
+void SCIPtraceFree(
+   SCIP_TRACE**          trace               /**< pointer to the trace */
+   )
+{
+   assert(trace != NULL);
+   assert(*trace != NULL);
+
+   BMSfreeMemoryArrayNull(&(*trace)->events);
+   SCIPclockFree(&(*trace)->clock);
+
+   BMSfreeMemory(trace);
+}
+
+/** initializes the trace at the beginning of the solving process
+ *
+ *  Whether events are recorded is decided here once for the whole solving process, so that changing timing/trace
+ *  during the solve cannot leave events open.
+ */
+SCIP_RETCODE SCIPtraceInit(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Bool             active              /**< should events be recorded? */
+   )
+{
+   assert(trace != NULL);
+   assert(set != NULL);
+
+   /* no events are open between two runs, even if an event was not closed due to an error */
+   trace->depth = 0;
+
+   /* keep recording over restarts */
+   if( SCIPclockIsRunning(trace->clock) )
+      return SCIP_OKAY;
+
+   trace->nevents = 0;
+   trace->threadnum = SCIPtpiGetThreadNum();
+   trace->active = active;
+
+   if( !active )
+      return SCIP_OKAY;
+
+   /* the time stamps are relative to the start of the solving process */
+   SCIPclockReset(trace->clock);
+   SCIPclockStart(trace->clock, set);
+
+   return SCIP_OKAY;
+}
+
+/** finishes the trace at the end of the solving process and writes it to a file, if requested */
+SCIP_RETCODE SCIPtraceExit(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   const char*           filename,           /**< name of file to write trace to, or NULL */
+   SCIP_Bool             appendthreadnum     /**< should the thread number be appended to the file name? */
+   )
+{
+   char threadfilename[SCIP_MAXSTRLEN];
+
+   assert(trace != NULL);
+   assert(set != NULL);
+
+   if( SCIPclockIsRunning(trace->clock) )
+      SCIPclockStop(trace->clock, set);
+
+   if( filename != NULL && trace->active && trace->nevents > 0 )
+   {
+      if( appendthreadnum )
+      {
+         (void) SCIPsnprintf(threadfilename, SCIP_MAXSTRLEN, "%s.%d", filename, trace->threadnum);
+         filename = threadfilename;
+      }
+
+      SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_NORMAL,
+         "storing trace of %" SCIP_LONGINT_FORMAT " events in file <%s>\n", MIN(trace->nevents, (SCIP_Longint)trace->eventssize), filename);
+
+      SCIP_CALL( SCIPtraceWrite(trace, messagehdlr, filename) );
+   }
+
+   /* release the ring buffer, its size may change until the next solve */
+   BMSfreeMemoryArrayNull(&trace->events);
+   trace->eventssize = 0;
+   trace->nevents = 0;
+   trace->depth = 0;
+   trace->active = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** opens a trace event; has to be closed by SCIPtraceEnd() */
+void SCIPtraceBegin(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   assert(trace != NULL);
+   assert(set != NULL);
+
+   if( !trace->active )
+      return;
+
+   if( trace->depth < SCIP_TRACE_MAXDEPTH )
+      trace->starts[trace->depth] = SCIPclockGetTime(trace->clock);
+   ++trace->depth;
+}
+
+/** closes the last opened trace event without recording it */
+void SCIPtraceCancel(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   assert(trace != NULL);
+   assert(set != NULL);
+
+   if( !trace->active || trace->depth == 0 )
+      return;
+
+   --trace->depth;
+}
+
+/** closes the last opened trace event and records it */
+void SCIPtraceEnd(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_TRACECAT         cat,                /**< category of event */
+   const char*           name                /**< name of event; has to be valid until the trace is written */
+   )
+{
+   SCIP_TRACEEVENT* event;
+
+   assert(trace != NULL);
+   assert(set != NULL);
+   assert(name != NULL);
+
+   if( !trace->active || trace->depth == 0 )
+      return;
+
+   --trace->depth;
+
+   /* events that are nested too deeply are not recorded */
+   if( trace->depth >= SCIP_TRACE_MAXDEPTH )
+      return;
+
+   /* allocate the ring buffer only when the first event is recorded */
+   if( trace->events == NULL )
+   {
+      if( BMSallocMemoryArray(&trace->events, set->time_tracebuffersize) == NULL )
+         return;
+      trace->eventssize = set->time_tracebuffersize;
+   }
+   assert(trace->eventssize > 0);
+
+   event = &trace->events[trace->nevents % trace->eventssize];
+   event->name = name;
+   event->cat = cat;
+   event->start = trace->starts[trace->depth];
+   event->duration = SCIPclockGetTime(trace->clock) - event->start;
+   ++trace->nevents;
+}
+
+/** writes the recorded events in the Chrome trace event format, which can be loaded into chrome://tracing or Perfetto */
+SCIP_RETCODE SCIPtraceWrite(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   const char*           filename            /**< name of file to write trace to */
+   )
+{
+   FILE* file;
+   SCIP_Longint first;
+   SCIP_Longint i;
+
+   assert(trace != NULL);
+   assert(filename != NULL);
+
+   file = fopen(filename, "w");
+   if( file == NULL )
+   {
+      SCIPerrorMessage("error creating file <%s>\n", filename);
+      SCIPprintSysError(filename);
+      return SCIP_FILECREATEERROR;
+   }
+
+   SCIPmessageFPrintInfo(messagehdlr, file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+   SCIPmessageFPrintInfo(messagehdlr, file,
+      "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"SCIP thread %d\"}}",
+      trace->threadnum, trace->threadnum);
+
+   /* if the ring buffer has overflown, then the oldest event is at the current insertion position */
+   first = trace->nevents > trace->eventssize ? trace->nevents - trace->eventssize : 0;
+
+   for( i = first; i < trace->nevents; ++i )
+   {
+      SCIP_TRACEEVENT* event = &trace->events[i % trace->eventssize];
+
+      /* time stamps and durations are given in microseconds */
+      SCIPmessageFPrintInfo(messagehdlr, file, ",\n{\"name\":");
+      printJSONString(messagehdlr, file, event->name);
+      SCIPmessageFPrintInfo(messagehdlr, file, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+         tracecatnames[event->cat], trace->threadnum, 1e6 * event->start, 1e6 * event->duration);
+   }
+
+   SCIPmessageFPrintInfo(messagehdlr, file, "\n]}\n");
+
+   fclose(file);
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,103 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   trace.h
+ * @ingroup INTERNALAPI
+ * @brief  methods for tracing the solving process and exporting traces in the Chrome trace event format
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_TRACE_H__
+#define __SCIP_TRACE_H__
+
+
+#include "scip/def.h"
+#include "scip/type_message.h"
+#include "scip/type_retcode.h"
+#include "scip/type_set.h"
+#include "scip/type_trace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates trace data structure */
+SCIP_RETCODE SCIPtraceCreate(
+   SCIP_TRACE**          trace               /**< pointer to store the trace */
+   );
+
+/** frees trace data structure */
+void SCIPtraceFree(
+   SCIP_TRACE**          trace               /**< pointer to the trace */
+   );
+
+/** initializes the trace at the beginning of the solving process */
+SCIP_RETCODE SCIPtraceInit(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Bool             active              /**< should events be recorded? */
+   );
+
+/** finishes the trace at the end of the solving process and writes it to a file, if requested */
+SCIP_RETCODE SCIPtraceExit(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   const char*           filename,           /**< name of file to write trace to, or NULL */
+   SCIP_Bool             appendthreadnum     /**< should the thread number be appended to the file name? */
+   );
+
+/** opens a trace event; has to be closed by SCIPtraceEnd() */
+void SCIPtraceBegin(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
+/** closes the last opened trace event without recording it */
+void SCIPtraceCancel(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
+/** closes the last opened trace event and records it */
+void SCIPtraceEnd(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_TRACECAT         cat,                /**< category of event */
+   const char*           name                /**< name of event; has to be valid until the trace is written */
+   );
+
+/** writes the recorded events in the Chrome trace event format, which can be loaded into chrome://tracing or Perfetto */
+SCIP_RETCODE SCIPtraceWrite(
+   SCIP_TRACE*           trace,              /**< trace */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   const char*           filename            /**< name of file to write trace to */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -721,6 +721,30 @@ typedef struct SCIP_ExprIter     SCIP_EXPRITER;      /**< expression iterator */
 
 /** @} */  /* expression iterator */
 
+/**@name Expression Evaluation Tape
+ * @{
+ */
+
+/** operation codes of the instructions of an expression evaluation tape */
+typedef enum
+{
+   SCIP_EXPRTAPE_OP_VAR       = 0,       /**< value of a variable */
+   SCIP_EXPRTAPE_OP_VALUE     = 1,       /**< constant value */
+   SCIP_EXPRTAPE_OP_SUM       = 2,       /**< weighted sum of arguments plus constant */
+   SCIP_EXPRTAPE_OP_PRODUCT   = 3,       /**< product of arguments times coefficient */
+   SCIP_EXPRTAPE_OP_POW       = 4,       /**< power of argument */
+   SCIP_EXPRTAPE_OP_SIGNPOWER = 5,       /**< signed power of argument */
+   SCIP_EXPRTAPE_OP_EXP       = 6,       /**< exponential of argument */
+   SCIP_EXPRTAPE_OP_LOG       = 7,       /**< natural logarithm of argument */
+   SCIP_EXPRTAPE_OP_ABS       = 8,       /**< absolute value of argument */
+   SCIP_EXPRTAPE_OP_GENERIC   = 9        /**< evaluation by the callbacks of the expression handler */
+} SCIP_EXPRTAPE_OPCODE;
+
+typedef struct SCIP_ExprTapeInstr SCIP_EXPRTAPEINSTR; /**< instruction of an expression evaluation tape */
+typedef struct SCIP_ExprTape      SCIP_EXPRTAPE;      /**< expression evaluation tape */
+
+/** @} */  /* expression evaluation tape */
+
 /** @name Expression printing
  * @{
  */
@@ -78,6 +78,7 @@ typedef struct SCIP_HeurData SCIP_HEURDATA;       /**< locally defined primal he
 typedef struct SCIP_Diveset SCIP_DIVESET;         /**< common parameters for all diving heuristics */
 typedef struct SCIP_VGraph SCIP_VGRAPH;           /**< variable graph data structure to determine breadth-first
                                                     *  distances between variables */
+typedef struct SCIP_CheckedSol SCIP_CHECKEDSOL;   /**< working solution with incrementally updated LP row activities */
 
 /** commonly used display characters indicating special classes of primal heuristics */
 #define SCIP_HEURDISPCHAR_LNS       'L'  /**< a 'L'arge Neighborhood or other local search heuristic */
@@ -0,0 +1,59 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   type_trace.h
+ * @ingroup TYPEDEFINITIONS
+ * @brief  type definitions for tracing of the solving process
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_TYPE_TRACE_H__
+#define __SCIP_TYPE_TRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** categories of trace events */
+enum SCIP_TraceCat
+{
+   SCIP_TRACECAT_NODE     = 0,               /**< processing of a branch-and-bound node */
+   SCIP_TRACECAT_LP       = 1,               /**< solving of the LP relaxation */
+   SCIP_TRACECAT_SEPA     = 2,               /**< execution of a separator */
+   SCIP_TRACECAT_PROP     = 3,               /**< execution of a propagator */
+   SCIP_TRACECAT_HEUR     = 4,               /**< execution of a primal heuristic */
+   SCIP_TRACECAT_CONSENFO = 5,               /**< enforcement callback of a constraint handler */
+   SCIP_TRACECAT_BRANCH   = 6                /**< execution of a branching rule */
+};
+typedef enum SCIP_TraceCat SCIP_TRACECAT;    /**< category of a trace event */
+
+typedef struct SCIP_TraceEvent SCIP_TRACEEVENT;  /**< event of a trace, that is, a timed span */
+typedef struct SCIP_Trace SCIP_TRACE;        /**< trace of the solving process */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -519,7 +519,7 @@ SCIP_RETCODE varAddLbchginfo(
    var->lbchginfos[var->nlbchginfos].redundant = FALSE;
    var->lbchginfos[var->nlbchginfos].inferboundtype = inferboundtype; /*lint !e641*/
    var->lbchginfos[var->nlbchginfos].inferencedata.var = infervar;
-   var->lbchginfos[var->nlbchginfos].inferencedata.info = inferinfo;
+   var->lbchginfos[var->nlbchginfos].inferinfo = inferinfo;
 
    /**@note The "pos" data member of the bound change info has a size of 27 bits */
    assert(var->nlbchginfos < 1 << 27);
@@ -594,7 +594,7 @@ SCIP_RETCODE varAddUbchginfo(
    var->ubchginfos[var->nubchginfos].redundant = FALSE;
    var->ubchginfos[var->nubchginfos].inferboundtype = inferboundtype; /*lint !e641*/
    var->ubchginfos[var->nubchginfos].inferencedata.var = infervar;
-   var->ubchginfos[var->nubchginfos].inferencedata.info = inferinfo;
+   var->ubchginfos[var->nubchginfos].inferinfo = inferinfo;
 
    /**@note The "pos" data member of the bound change info has a size of 27 bits */
    assert(var->nubchginfos < 1 << 27);
@@ -686,7 +686,7 @@ SCIP_RETCODE SCIPboundchgApply(
                   SCIPvarGetName(var), var->locdom.lb, var->locdom.ub, boundchg->newbound);
                SCIP_CALL( varAddLbchginfo(var, blkmem, set, var->locdom.lb, boundchg->newbound, depth, pos,
                      boundchg->data.inferencedata.var, boundchg->data.inferencedata.reason.cons, NULL,
-                     boundchg->data.inferencedata.info,
+                     boundchg->inferinfo,
                      (SCIP_BOUNDTYPE)(boundchg->inferboundtype), SCIP_BOUNDCHGTYPE_CONSINFER) );
                break;
 
@@ -697,7 +697,7 @@ SCIP_RETCODE SCIPboundchgApply(
                   SCIPvarGetName(var), var->locdom.lb, var->locdom.ub, boundchg->newbound);
                SCIP_CALL( varAddLbchginfo(var, blkmem, set, var->locdom.lb, boundchg->newbound, depth, pos,
                      boundchg->data.inferencedata.var, NULL, boundchg->data.inferencedata.reason.prop,
-                     boundchg->data.inferencedata.info,
+                     boundchg->inferinfo,
                      (SCIP_BOUNDTYPE)(boundchg->inferboundtype), SCIP_BOUNDCHGTYPE_PROPINFER) );
                break;
 
@@ -753,7 +753,7 @@ SCIP_RETCODE SCIPboundchgApply(
                   SCIPvarGetName(var), var->locdom.lb, var->locdom.ub, boundchg->newbound);
                SCIP_CALL( varAddUbchginfo(var, blkmem, set, var->locdom.ub, boundchg->newbound, depth, pos,
                      boundchg->data.inferencedata.var, boundchg->data.inferencedata.reason.cons, NULL,
-                     boundchg->data.inferencedata.info,
+                     boundchg->inferinfo,
                      (SCIP_BOUNDTYPE)(boundchg->inferboundtype), SCIP_BOUNDCHGTYPE_CONSINFER) );
                break;
 
@@ -764,7 +764,7 @@ SCIP_RETCODE SCIPboundchgApply(
                   SCIPvarGetName(var), var->locdom.lb, var->locdom.ub, boundchg->newbound);
                SCIP_CALL( varAddUbchginfo(var, blkmem, set, var->locdom.ub, boundchg->newbound, depth, pos,
                      boundchg->data.inferencedata.var, NULL, boundchg->data.inferencedata.reason.prop,
-                     boundchg->data.inferencedata.info,
+                     boundchg->inferinfo,
                      (SCIP_BOUNDTYPE)(boundchg->inferboundtype), SCIP_BOUNDCHGTYPE_PROPINFER) );
                break;
 
@@ -1034,6 +1034,11 @@ SCIP_RETCODE boundchgReleaseData(
    return SCIP_OKAY;
 }
 
+/** size of the memory block of static domain change data without hole changes, which stores its bound changes directly
+ *  behind the header, such that the bound changes of a node are contiguous in memory when switching the active path
+ */
+#define domchgBoundSize(nboundchgs) (sizeof(SCIP_DOMCHGBOUND) + (size_t)(nboundchgs) * sizeof(SCIP_BOUNDCHG))
+
 /** creates empty domain change data with dynamic arrays */
 static
 SCIP_RETCODE domchgCreate(
@@ -1082,8 +1087,8 @@ SCIP_RETCODE SCIPdomchgFree(
       switch( (*domchg)->domchgdyn.domchgtype )
       {
       case SCIP_DOMCHGTYPE_BOUND:
-         BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgbound.boundchgs, (*domchg)->domchgbound.nboundchgs);
-         BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOUND));
+         assert((*domchg)->domchgbound.boundchgs == (SCIP_BOUNDCHG*)(&(*domchg)->domchgbound + 1));
+         BMSfreeBlockMemorySize(blkmem, domchg, domchgBoundSize((*domchg)->domchgbound.nboundchgs));
          break;
       case SCIP_DOMCHGTYPE_BOTH:
          BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgboth.boundchgs, (*domchg)->domchgboth.nboundchgs);
@@ -1125,13 +1130,25 @@ SCIP_RETCODE domchgMakeDynamic(
       switch( (*domchg)->domchgdyn.domchgtype )
       {
       case SCIP_DOMCHGTYPE_BOUND:
-         SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOUND), sizeof(SCIP_DOMCHGDYN)) );
+      {
+         SCIP_BOUNDCHG* boundchgs;
+         int nboundchgs;
+
+         /* move the bound changes from behind the header into a separate array that can grow */
+         nboundchgs = (int) (*domchg)->domchgbound.nboundchgs;
+         SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &boundchgs, (*domchg)->domchgbound.boundchgs, nboundchgs) );
+         BMSfreeBlockMemorySize(blkmem, domchg, domchgBoundSize(nboundchgs));
+
+         SCIP_ALLOC( BMSallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGDYN)) );
+         (*domchg)->domchgdyn.nboundchgs = (unsigned int) nboundchgs;
+         (*domchg)->domchgdyn.boundchgs = boundchgs;
          (*domchg)->domchgdyn.nholechgs = 0;
          (*domchg)->domchgdyn.holechgs = NULL;
-         (*domchg)->domchgdyn.boundchgssize = (int) (*domchg)->domchgdyn.nboundchgs;
+         (*domchg)->domchgdyn.boundchgssize = nboundchgs;
          (*domchg)->domchgdyn.holechgssize = 0;
          (*domchg)->domchgdyn.domchgtype = SCIP_DOMCHGTYPE_DYNAMIC; /*lint !e641*/
          break;
+      }
       case SCIP_DOMCHGTYPE_BOTH:
          SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOTH), sizeof(SCIP_DOMCHGDYN)) );
          (*domchg)->domchgdyn.boundchgssize = (int) (*domchg)->domchgdyn.nboundchgs;
@@ -1157,6 +1174,54 @@ SCIP_RETCODE domchgMakeDynamic(
    return SCIP_OKAY;
 }
 
+/** converts dynamic or static domain change data without hole changes into static domain change data that stores its
+ *  bound changes in the same memory block
+ */
+static
+SCIP_RETCODE domchgMakeBound(
+   SCIP_DOMCHG**         domchg,             /**< pointer to domain change data */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   SCIP_DOMCHG* newdomchg;
+   int nboundchgs;
+
+   assert(domchg != NULL);
+   assert(*domchg != NULL);
+   assert((*domchg)->domchgdyn.domchgtype != SCIP_DOMCHGTYPE_BOUND); /*lint !e641*/
+   assert((*domchg)->domchgboth.nholechgs == 0);
+   assert(blkmem != NULL);
+
+   nboundchgs = (int) (*domchg)->domchgbound.nboundchgs;
+   assert(nboundchgs > 0);
+
+   SCIP_ALLOC( BMSallocBlockMemorySize(blkmem, &newdomchg, domchgBoundSize(nboundchgs)) );
+   newdomchg->domchgbound.nboundchgs = (unsigned int) nboundchgs;
+   newdomchg->domchgbound.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+   newdomchg->domchgbound.boundchgs = (SCIP_BOUNDCHG*)(&newdomchg->domchgbound + 1);
+
+   /* the bound changes are moved, so their data is not released */
+   BMScopyMemoryArray(newdomchg->domchgbound.boundchgs, (*domchg)->domchgbound.boundchgs, nboundchgs);
+
+   if( (*domchg)->domchgdyn.domchgtype == SCIP_DOMCHGTYPE_DYNAMIC ) /*lint !e641*/
+   {
+      BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgdyn.boundchgs, (*domchg)->domchgdyn.boundchgssize);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgdyn.holechgs, (*domchg)->domchgdyn.holechgssize);
+      BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGDYN));
+   }
+   else
+   {
+      assert((*domchg)->domchgdyn.domchgtype == SCIP_DOMCHGTYPE_BOTH); /*lint !e641*/
+      BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgboth.boundchgs, nboundchgs);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgboth.holechgs, (*domchg)->domchgboth.nholechgs);
+      BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOTH));
+   }
+
+   *domchg = newdomchg;
+
+   return SCIP_OKAY;
+}
+
 /** converts a dynamic domain change data into a static one, using less memory than for a dynamic one */
 SCIP_RETCODE SCIPdomchgMakeStatic(
    SCIP_DOMCHG**         domchg,             /**< pointer to domain change data */
@@ -1190,8 +1255,7 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
             }
             else
             {
-               SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOTH), sizeof(SCIP_DOMCHGBOUND)) );
-               (*domchg)->domchgdyn.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+               SCIP_CALL( domchgMakeBound(domchg, blkmem) );
             }
          }
          break;
@@ -1204,14 +1268,8 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
             }
             else
             {
-               /* shrink dynamic size arrays to their minimal sizes */
-               SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*domchg)->domchgdyn.boundchgs, \
-                     (*domchg)->domchgdyn.boundchgssize, (*domchg)->domchgdyn.nboundchgs) ); /*lint !e571*/
-               BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgdyn.holechgs, (*domchg)->domchgdyn.holechgssize);
-
-               /* convert into static domain change */
-               SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGDYN), sizeof(SCIP_DOMCHGBOUND)) );
-               (*domchg)->domchgdyn.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+               /* convert into static domain change with the bound changes stored behind the header */
+               SCIP_CALL( domchgMakeBound(domchg, blkmem) );
             }
          }
          else
@@ -1473,17 +1531,18 @@ SCIP_RETCODE SCIPdomchgAddBoundchg(
    {
    case SCIP_BOUNDCHGTYPE_BRANCHING:
       boundchg->data.branchingdata.lpsolval = lpsolval;
+      boundchg->inferinfo = 0;
       break;
    case SCIP_BOUNDCHGTYPE_CONSINFER:
       assert(infercons != NULL);
       boundchg->data.inferencedata.var = infervar;
       boundchg->data.inferencedata.reason.cons = infercons;
-      boundchg->data.inferencedata.info = inferinfo; 
+      boundchg->inferinfo = inferinfo;
       break;
    case SCIP_BOUNDCHGTYPE_PROPINFER:
       boundchg->data.inferencedata.var = infervar;
       boundchg->data.inferencedata.reason.prop = inferprop;
-      boundchg->data.inferencedata.info = inferinfo; 
+      boundchg->inferinfo = inferinfo;
       break;
    default:
       SCIPerrorMessage("invalid bound change type %d\n", boundchgtype);
@@ -16547,7 +16606,7 @@ SCIP_RETCODE SCIPbdchginfoCreate(
    (*bdchginfo)->var = var;
    (*bdchginfo)->inferencedata.var = var;
    (*bdchginfo)->inferencedata.reason.prop = NULL;
-   (*bdchginfo)->inferencedata.info = 0;
+   (*bdchginfo)->inferinfo = 0;
    (*bdchginfo)->bdchgidx.depth = INT_MAX;
    (*bdchginfo)->bdchgidx.pos = -1;
    (*bdchginfo)->pos = 0;
@@ -18780,7 +18839,7 @@ int SCIPbdchginfoGetInferInfo(
    assert((SCIP_BOUNDCHGTYPE)bdchginfo->boundchgtype == SCIP_BOUNDCHGTYPE_CONSINFER
       || (SCIP_BOUNDCHGTYPE)bdchginfo->boundchgtype == SCIP_BOUNDCHGTYPE_PROPINFER);
 
-   return bdchginfo->inferencedata.info;
+   return bdchginfo->inferinfo;
 }
 
 /** returns inference bound of inference variable of given bound change information */
@@ -0,0 +1,139 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cutaggregation.c
+ * @brief  unit tests for the aggregation and the duplicate detection of Benders' optimality cuts
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/pub_benders.h"
+#include "include/scip_test.h"
+
+#define INSTANCE "../check/instances/Stochastic/sslp_5_25_5.smps"
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip = NULL;
+
+/* TEST SUITE */
+
+/** creates a SCIP instance that solves the stochastic program with the default Benders' decomposition */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "reading/storeader/usebenders", TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+/** frees the SCIP instance */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** solves the instance with the given Benders' cut settings and returns the optimal objective value */
+static
+SCIP_Real solveInstance(
+   int                   cutaggrsize,        /**< number of subproblems whose optimality cuts are aggregated */
+   SCIP_Bool             dedupcuts,          /**< should near-duplicate cuts be detected? */
+   int*                  naggregatedcuts,    /**< pointer to store the number of aggregated cuts */
+   int*                  nduplicatecuts      /**< pointer to store the number of detected duplicate cuts */
+   )
+{
+   SCIP_BENDERS* benders;
+   SCIP_Real objval;
+
+   SCIP_CALL( SCIPreadProb(scip, INSTANCE, NULL) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "benders/default/cutaggrsize", cutaggrsize) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "benders/default/dedupcuts", dedupcuts) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   benders = SCIPfindBenders(scip, "default");
+   cr_assert_not_null(benders);
+
+   objval = SCIPgetPrimalbound(scip);
+   *naggregatedcuts = SCIPbendersGetNAggregatedCuts(benders);
+   *nduplicatecuts = SCIPbendersGetNDuplicateCuts(benders);
+
+   SCIP_CALL( SCIPfreeProb(scip) );
+
+   return objval;
+}
+
+/* TESTS */
+
+Test(cutaggregation, multicut, .init = setup, .fini = teardown,
+   .description = "check that no cuts are aggregated if each subproblem generates its own cut")
+{
+   int naggregatedcuts;
+   int nduplicatecuts;
+
+   (void) solveInstance(1, FALSE, &naggregatedcuts, &nduplicatecuts);
+
+   cr_assert_eq(naggregatedcuts, 0);
+   cr_assert_eq(nduplicatecuts, 0);
+}
+
+Test(cutaggregation, singlecut, .init = setup, .fini = teardown,
+   .description = "check that aggregating the optimality cuts of all subproblems gives the same optimal value")
+{
+   SCIP_Real multicutobj;
+   SCIP_Real singlecutobj;
+   int naggregatedcuts;
+   int nduplicatecuts;
+
+   multicutobj = solveInstance(1, FALSE, &naggregatedcuts, &nduplicatecuts);
+   singlecutobj = solveInstance(INT_MAX, FALSE, &naggregatedcuts, &nduplicatecuts);
+
+   cr_assert(SCIPisFeasEQ(scip, multicutobj, singlecutobj), "multi-cut %g != single-cut %g", multicutobj, singlecutobj);
+   cr_assert_gt(naggregatedcuts, 0);
+}
+
+Test(cutaggregation, partialaggregation, .init = setup, .fini = teardown,
+   .description = "check that partially aggregating the optimality cuts with duplicate detection gives the same optimal value")
+{
+   SCIP_Real multicutobj;
+   SCIP_Real aggrobj;
+   int naggregatedcuts;
+   int nduplicatecuts;
+
+   multicutobj = solveInstance(1, FALSE, &naggregatedcuts, &nduplicatecuts);
+   aggrobj = solveInstance(2, TRUE, &naggregatedcuts, &nduplicatecuts);
+
+   cr_assert(SCIPisFeasEQ(scip, multicutobj, aggrobj), "multi-cut %g != aggregated %g", multicutobj, aggrobj);
+   cr_assert_gt(naggregatedcuts, 0);
+   cr_assert_geq(nduplicatecuts, 0);
+}
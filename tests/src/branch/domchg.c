@@ -0,0 +1,330 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   domchg.c
+ * @brief  unit tests for the storage of bound changes in the domain changes of tree nodes
+ *
+ * The domain changes of nodes are dynamic while a node is the focus node or gets new bound changes, and static while
+ * the node is a leaf or an inner node of the tree. The tests check that the bound changes, including the inference
+ * information, survive these conversions.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NBINVARS 8
+#define NINTVARS 4
+#define INFERINFO(i) (1000 + 17 * (i))
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+static SCIP_VAR* binvars[NBINVARS];
+static SCIP_VAR* intvars[NINTVARS];
+static SCIP_PROP* testprop;
+
+static SCIP_Longint infernodenum;            /**< number of node where bound changes with inference information were deduced */
+static SCIP_Bool leftinfernode;              /**< was a node outside of the subtree of the inference node focused? */
+static SCIP_Bool checkedinfer;               /**< were the inferred bound changes checked after reapplying them? */
+static SCIP_Longint leafnodenum;             /**< number of leaf that got a further bound change */
+static SCIP_Bool checkedleaf;                /**< were the bound changes of the leaf checked when it was focused? */
+
+/** returns the ancestor of the given node at the given depth */
+static
+SCIP_NODE* getAncestor(
+   SCIP_NODE*            node,               /**< node */
+   int                   depth               /**< depth of ancestor */
+   )
+{
+   while( node != NULL && SCIPnodeGetDepth(node) > depth )
+      node = SCIPnodeGetParent(node);
+
+   return node;
+}
+
+/** checks that the inferred bound changes of the inference node are stored in the node and in the variables */
+static
+void checkInferredBoundchgs(
+   SCIP_NODE*            infernode           /**< node where bound changes were inferred */
+   )
+{
+   SCIP_DOMCHG* domchg;
+   int nfound = 0;
+   int i;
+   int j;
+
+   domchg = SCIPnodeGetDomchg(infernode);
+   cr_assert_not_null(domchg);
+
+   for( j = 0; j < SCIPdomchgGetNBoundchgs(domchg); ++j )
+   {
+      SCIP_BOUNDCHG* boundchg = SCIPdomchgGetBoundchg(domchg, j);
+
+      for( i = 0; i < NINTVARS; ++i )
+      {
+         if( SCIPboundchgGetVar(boundchg) != SCIPvarGetTransVar(intvars[i]) )
+            continue;
+
+         cr_expect_eq(SCIPboundchgGetNewbound(boundchg), (SCIP_Real)(9 - i));
+         cr_expect_eq(SCIPboundchgGetBoundtype(boundchg), SCIP_BOUNDTYPE_UPPER);
+         cr_expect_eq(SCIPboundchgGetBoundchgtype(boundchg), SCIP_BOUNDCHGTYPE_PROPINFER);
+         ++nfound;
+      }
+   }
+   cr_expect_eq(nfound, NINTVARS);
+
+   /* the bound change information of the variables is created from the node's domain change */
+   for( i = 0; i < NINTVARS; ++i )
+   {
+      SCIP_VAR* var = SCIPvarGetTransVar(intvars[i]);
+      SCIP_BDCHGINFO* bdchginfo = NULL;
+      int pos;
+
+      for( pos = 0; pos < SCIPvarGetNBdchgInfosUb(var); ++pos )
+      {
+         bdchginfo = SCIPvarGetBdchgInfoUb(var, pos);
+         if( SCIPbdchginfoGetDepth(bdchginfo) == SCIPnodeGetDepth(infernode) )
+            break;
+      }
+      cr_assert_lt(pos, SCIPvarGetNBdchgInfosUb(var), "no bound change info for <%s>", SCIPvarGetName(var));
+
+      cr_expect_eq(SCIPbdchginfoGetNewbound(bdchginfo), (SCIP_Real)(9 - i));
+      cr_expect_eq(SCIPbdchginfoGetChgtype(bdchginfo), SCIP_BOUNDCHGTYPE_PROPINFER);
+      cr_expect_eq(SCIPbdchginfoGetInferProp(bdchginfo), testprop);
+      cr_expect_eq(SCIPbdchginfoGetInferInfo(bdchginfo), INFERINFO(i));
+      cr_expect_eq(SCIPbdchginfoGetInferVar(bdchginfo), var);
+   }
+}
+
+/** adds a bound change to a leaf, whose domain change is static, and checks that its bound changes are kept */
+static
+void addLeafBoundchg(void)
+{
+   SCIP_NODE** leaves;
+   SCIP_NODE* leaf;
+   SCIP_DOMCHG* domchg;
+   SCIP_VAR* boundchgvars[NBINVARS + NINTVARS];
+   SCIP_Real newbounds[NBINVARS + NINTVARS];
+   SCIP_BOUNDTYPE boundtypes[NBINVARS + NINTVARS];
+   SCIP_VAR* var;
+   int nboundchgs;
+   int nleaves;
+   int j;
+
+   SCIP_CALL( SCIPgetLeaves(scip, &leaves, &nleaves) );
+   if( nleaves == 0 )
+      return;
+
+   leaf = leaves[0];
+   domchg = SCIPnodeGetDomchg(leaf);
+   nboundchgs = SCIPdomchgGetNBoundchgs(domchg);
+   cr_assert_gt(nboundchgs, 0);
+   cr_assert_leq(nboundchgs, NBINVARS + NINTVARS);
+
+   for( j = 0; j < nboundchgs; ++j )
+   {
+      SCIP_BOUNDCHG* boundchg = SCIPdomchgGetBoundchg(domchg, j);
+
+      boundchgvars[j] = SCIPboundchgGetVar(boundchg);
+      newbounds[j] = SCIPboundchgGetNewbound(boundchg);
+      boundtypes[j] = SCIPboundchgGetBoundtype(boundchg);
+   }
+
+   /* the last integer variable is not changed by the propagator below the root */
+   var = SCIPvarGetTransVar(intvars[NINTVARS - 1]);
+   SCIP_CALL( SCIPchgVarUbNode(scip, leaf, var, 3.0) );
+
+   domchg = SCIPnodeGetDomchg(leaf);
+   cr_assert_eq(SCIPdomchgGetNBoundchgs(domchg), nboundchgs + 1);
+
+   for( j = 0; j < nboundchgs; ++j )
+   {
+      SCIP_BOUNDCHG* boundchg = SCIPdomchgGetBoundchg(domchg, j);
+
+      cr_expect_eq(SCIPboundchgGetVar(boundchg), boundchgvars[j]);
+      cr_expect_eq(SCIPboundchgGetNewbound(boundchg), newbounds[j]);
+      cr_expect_eq(SCIPboundchgGetBoundtype(boundchg), boundtypes[j]);
+   }
+   cr_expect_eq(SCIPboundchgGetVar(SCIPdomchgGetBoundchg(domchg, nboundchgs)), var);
+   cr_expect_eq(SCIPboundchgGetNewbound(SCIPdomchgGetBoundchg(domchg, nboundchgs)), 3.0);
+   cr_expect_eq(SCIPboundchgGetBoundtype(SCIPdomchgGetBoundchg(domchg, nboundchgs)), SCIP_BOUNDTYPE_UPPER);
+
+   leafnodenum = SCIPnodeGetNumber(leaf);
+}
+
+/** propagator that deduces bound changes with inference information at the first node in depth 1 and checks them
+ *  later, after they were reapplied from the static domain change of that node
+ */
+static
+SCIP_DECL_PROPEXEC(propExecTest)
+{
+   SCIP_NODE* node;
+   SCIP_NODE* ancestor;
+
+   *result = SCIP_DIDNOTRUN;
+
+   node = SCIPgetCurrentNode(scip);
+
+   if( SCIPnodeGetNumber(node) == leafnodenum )
+   {
+      cr_expect(SCIPisLE(scip, SCIPvarGetUbLocal(SCIPvarGetTransVar(intvars[NINTVARS - 1])), 3.0));
+      checkedleaf = TRUE;
+   }
+
+   if( SCIPgetDepth(scip) < 1 )
+      return SCIP_OKAY;
+
+   if( infernodenum < 0 )
+   {
+      int i;
+
+      /* infer bound changes with different inference information; they are stored in the node's domain change */
+      for( i = 0; i < NINTVARS; ++i )
+      {
+         SCIP_Bool infeasible;
+         SCIP_Bool tightened;
+
+         SCIP_CALL( SCIPinferVarUbProp(scip, SCIPvarGetTransVar(intvars[i]), (SCIP_Real)(9 - i), prop, INFERINFO(i),
+               FALSE, &infeasible, &tightened) );
+         cr_assert_not(infeasible);
+         cr_assert(tightened);
+      }
+      infernodenum = SCIPnodeGetNumber(node);
+      *result = SCIP_REDUCEDDOM;
+
+      return SCIP_OKAY;
+   }
+
+   ancestor = getAncestor(node, 1);
+   assert(ancestor != NULL);
+
+   if( SCIPnodeGetNumber(ancestor) != infernodenum )
+   {
+      leftinfernode = TRUE;
+      return SCIP_OKAY;
+   }
+
+   /* the bound changes of the inference node are reapplied from its static domain change after switching the path */
+   if( leftinfernode && !checkedinfer && SCIPnodeGetDepth(node) > 1 )
+   {
+      checkInferredBoundchgs(ancestor);
+      checkedinfer = TRUE;
+
+      addLeafBoundchg();
+   }
+
+   return SCIP_OKAY;
+}
+
+/* TEST SUITE */
+
+/** creates a problem that is solved by branching on the binary variables without an LP; the integer variables are
+ *  only changed by the test propagator
+ */
+static
+void setup(void)
+{
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "domchg") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "card", 0, NULL, NULL, -SCIPinfinity(scip), 3.0) );
+   for( i = 0; i < NBINVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &binvars[i], name, 0.0, 1.0, (SCIP_Real)(i + 1), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, binvars[i]) );
+      SCIP_CALL( SCIPaddCoefLinear(scip, cons, binvars[i], 1.0) );
+   }
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < NINTVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "y%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &intvars[i], name, 0.0, 10.0, 0.0, SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, intvars[i]) );
+   }
+
+   SCIP_CALL( SCIPincludePropBasic(scip, &testprop, "domchgtest", "infers bounds with inference information",
+         0, 1, FALSE, SCIP_PROPTIMING_BEFORELP, propExecTest, NULL) );
+
+   /* solve without LP and presolving, and visit the nodes level by level to switch the path between subtrees */
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "nodeselection/breadthfirst/stdpriority", 536870911) );
+
+   /* the integer variables have no locks, so dual fixing would fix them at the root */
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/dualfix/freq", -1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   infernodenum = -1;
+   leftinfernode = FALSE;
+   checkedinfer = FALSE;
+   leafnodenum = -1;
+   checkedleaf = FALSE;
+}
+
+/** releases variables and frees SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = NINTVARS - 1; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &intvars[i]) );
+   }
+   for( i = NBINVARS - 1; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &binvars[i]) );
+   }
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(domchg, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(domchg, roundtrip, .description = "check that bound changes and inference information survive static and dynamic domain changes")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   cr_assert_geq(infernodenum, 0, "no bound changes were inferred");
+   cr_assert(checkedinfer, "the inferred bound changes were not reapplied");
+   cr_assert_geq(leafnodenum, 0, "no leaf got a bound change");
+   cr_assert(checkedleaf, "the leaf with the additional bound change was not focused");
+}
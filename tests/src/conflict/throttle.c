@@ -0,0 +1,144 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   throttle.c
+ * @brief  unit tests for skipping conflict analysis types that were unproductive so far
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_conflict.h"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 16
+#define NCONSS 3
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+
+/* TEST SUITE */
+
+/** creates a multi-dimensional knapsack problem that is solved by branching without an LP, such that propagation
+ *  detects many infeasible nodes
+ */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS];
+   char name[SCIP_MAXSTRLEN];
+   int i;
+   int c;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "throttle") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real)((7 * i) % 11 + 5), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   for( c = 0; c < NCONSS; ++c )
+   {
+      SCIP_CONS* cons;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "capacity%d", c);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, 0, NULL, NULL, -SCIPinfinity(scip), 40.0 + 3.0 * c) );
+      for( i = 0; i < NVARS; ++i )
+      {
+         SCIP_CALL( SCIPaddCoefLinear(scip, cons, vars[i], (SCIP_Real)((5 * i + 3 * c) % 13 + 3)) );
+      }
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   /* allow conflicts with all variables; otherwise the conflicts of this small instance are too large to be analyzed */
+   SCIP_CALL( SCIPsetIntParam(scip, "conflict/minmaxvars", NVARS) );
+}
+
+/** frees SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(throttle, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(throttle, off, .description = "check that no conflict analysis is skipped by default")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   cr_assert_gt(scip->conflict->npropcalls, 100, "too few conflicts to check the throttling");
+   cr_expect_lt(scip->conflict->npropsuccess, 0.9 * scip->conflict->npropcalls);
+   cr_expect_eq(scip->conflict->npropskipped, 0);
+   cr_expect_eq(scip->conflict->npseudoskipped, 0);
+}
+
+Test(throttle, on, .description = "check that an unproductive conflict analysis type is only applied to every skipfreq-th conflict")
+{
+   SCIP_Longint ncandidates;
+   SCIP_Longint nthrottled;
+
+   /* propagation conflict analysis is successful for about every second conflict on this instance */
+   SCIP_CALL( SCIPsetRealParam(scip, "conflict/minsuccessrate", 0.9) );
+   SCIP_CALL( SCIPsetIntParam(scip, "conflict/minsuccesscalls", 20) );
+   SCIP_CALL( SCIPsetIntParam(scip, "conflict/skipfreq", 4) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   cr_assert_geq(scip->conflict->npropcalls, 20);
+   cr_assert_gt(scip->conflict->npropskipped, 0);
+
+   /* after the first 20 calls, only every 4th conflict is analyzed */
+   ncandidates = scip->conflict->npropcalls + scip->conflict->npropskipped;
+   nthrottled = ncandidates - 20;
+   cr_expect_leq(scip->conflict->npropcalls - 20, nthrottled / 4 + 1,
+      "%" SCIP_LONGINT_FORMAT " of %" SCIP_LONGINT_FORMAT " throttled conflicts were analyzed",
+      scip->conflict->npropcalls - 20, nthrottled);
+   cr_expect_geq(scip->conflict->npropcalls - 20, nthrottled / 4 - 1);
+}
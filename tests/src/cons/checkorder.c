@@ -0,0 +1,191 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   checkorder.c
+ * @brief  unit tests for checking solutions starting with the constraint handler that rejected the last solution
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_scip.h"
+#include "scip/struct_stat.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 8
+#define NPOINTS 200
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static SCIP_RANDNUMGEN* randnumgen;
+
+/* TEST SUITE */
+
+/** creates a problem with constraints of all constraint handlers that declare an order independent check */
+static
+void setup(void)
+{
+   SCIP_CONS* cons;
+   SCIP_Real vals[NVARS];
+   char name[SCIP_MAXSTRLEN];
+   SCIP_Longint weights[4] = {3, 5, 4, 6};
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "checkorder") );
+
+   /* the first six variables are binary, the last two are integer */
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, i < 6 ? 1.0 : 5.0, 1.0,
+            i < 6 ? SCIP_VARTYPE_BINARY : SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      vals[i] = (SCIP_Real)(i % 3 + 1);
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "linear", NVARS, vars, vals, 4.0, 14.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicKnapsack(scip, &cons, "knapsack", 4, vars, weights, 10) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicSetpack(scip, &cons, "setpack", 3, &vars[2]) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicLogicor(scip, &cons, "logicor", 3, &vars[3]) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* x6 - 2 x0 <= 3 */
+   SCIP_CALL( SCIPcreateConsBasicVarbound(scip, &cons, "varbound", vars[6], vars[0], -2.0, -SCIPinfinity(scip), 3.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 13, TRUE) );
+
+   SCIP_CALL( SCIPtransformProb(scip) );
+}
+
+/** releases variables and frees SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   SCIPfreeRandom(scip, &randnumgen);
+   for( i = NVARS - 1; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(checkorder, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(checkorder, sameresult, .description = "check that starting the check with any order independent constraint handler gives the same result")
+{
+   SCIP_CONSHDLR* conshdlrs[NVARS];
+   SCIP_CONSHDLR** allconshdlrs;
+   SCIP_SOL* sol;
+   int nconshdlrs = 0;
+   int ninfeasible = 0;
+   int nremembered = 0;
+   int h;
+   int p;
+
+   /* collect the constraint handlers that may be checked first */
+   allconshdlrs = SCIPgetConshdlrs(scip);
+   for( h = 0; h < SCIPgetNConshdlrs(scip) && nconshdlrs < NVARS; ++h )
+   {
+      if( SCIPconshdlrHasIndependentCheck(allconshdlrs[h]) )
+         conshdlrs[nconshdlrs++] = allconshdlrs[h];
+   }
+   cr_assert_geq(nconshdlrs, 5);
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   for( p = 0; p < NPOINTS; ++p )
+   {
+      SCIP_Bool expected;
+      SCIP_Bool feasible;
+      int i;
+
+      /* random point, which is fractional with small probability */
+      for( i = 0; i < NVARS; ++i )
+      {
+         SCIP_Real val = (SCIP_Real)SCIPrandomGetInt(randnumgen, 0, i < 6 ? 1 : 5);
+
+         if( SCIPrandomGetInt(randnumgen, 0, 9) == 0 )
+            val += 0.5;
+         SCIP_CALL( SCIPsetSolVal(scip, sol, SCIPvarGetTransVar(vars[i]), val) );
+      }
+
+      /* reference result, checking the constraint handlers in the order of their check priority */
+      scip->stat->lastcheckconshdlr = NULL;
+      SCIP_CALL( SCIPcheckSol(scip, sol, FALSE, FALSE, TRUE, TRUE, TRUE, &expected) );
+
+      if( !expected )
+      {
+         ++ninfeasible;
+         if( scip->stat->lastcheckconshdlr != NULL )
+         {
+            cr_expect(SCIPconshdlrHasIndependentCheck(scip->stat->lastcheckconshdlr));
+            ++nremembered;
+         }
+      }
+
+      /* the result must not depend on the constraint handler that is checked first */
+      for( h = 0; h < nconshdlrs; ++h )
+      {
+         scip->stat->lastcheckconshdlr = conshdlrs[h];
+         SCIP_CALL( SCIPcheckSol(scip, sol, FALSE, FALSE, TRUE, TRUE, TRUE, &feasible) );
+
+         cr_expect_eq(feasible, expected, "point %d: starting with <%s> gives %u instead of %u", p,
+            SCIPconshdlrGetName(conshdlrs[h]), feasible, expected);
+
+         /* a feasible solution does not change the remembered constraint handler */
+         if( feasible )
+            cr_expect_eq(scip->stat->lastcheckconshdlr, conshdlrs[h]);
+      }
+   }
+
+   /* the points have to cover feasible and infeasible solutions */
+   cr_expect_gt(ninfeasible, 0);
+   cr_expect_lt(ninfeasible, NPOINTS);
+   cr_expect_gt(nremembered, 0);
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+}
@@ -0,0 +1,155 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   explanation.c
+ * @brief  unit tests for resolving energy-based bound changes of cumulative constraints with stored explanations
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_conflict.h"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NJOBS 12
+#define CAPACITY 4
+#define HORIZON 60
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+
+/* TEST SUITE */
+
+/** creates a single resource scheduling problem with random jobs which minimizes the makespan */
+static
+void setup(void)
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_VAR* vars[NJOBS];
+   SCIP_VAR* makespan;
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int durations[NJOBS];
+   int demands[NJOBS];
+   int j;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "explanation") );
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &makespan, "makespan", 0.0, (SCIP_Real)HORIZON, 1.0, SCIP_VARTYPE_INTEGER) );
+   SCIP_CALL( SCIPaddVar(scip, makespan) );
+
+   for( j = 0; j < NJOBS; ++j )
+   {
+      SCIP_VAR* linvars[2];
+      SCIP_Real vals[2] = {1.0, -1.0};
+
+      durations[j] = SCIPrandomGetInt(randnumgen, 1, 6);
+      demands[j] = SCIPrandomGetInt(randnumgen, 1, 3);
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "s%d", j);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[j], name, 0.0, (SCIP_Real)(HORIZON - durations[j]), 0.0,
+            SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[j]) );
+
+      /* s_j + d_j <= makespan */
+      linvars[0] = vars[j];
+      linvars[1] = makespan;
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "end%d", j);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, 2, linvars, vals, -SCIPinfinity(scip),
+            (SCIP_Real)(-durations[j])) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicCumulative(scip, &cons, "cumulative", NJOBS, vars, durations, demands, CAPACITY) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( j = 0; j < NJOBS; ++j )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[j]) );
+   }
+   SCIP_CALL( SCIPreleaseVar(scip, &makespan) );
+   SCIPfreeRandom(scip, &randnumgen);
+
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   /* use both energy-based propagation algorithms */
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/efcheck", TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/efinfer", TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "conflict/minmaxvars", NJOBS + 1) );
+}
+
+/** frees SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(explanation, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(explanation, sameoptimum, .description = "check that stored explanations give the same optimal makespan as collecting the explanations during conflict analysis")
+{
+   SCIP_Real optimum;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/storeexplanations", FALSE) );
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert_gt(scip->conflict->npropcalls, 0, "no conflict was analyzed");
+   optimum = SCIPgetPrimalbound(scip);
+
+   SCIP_CALL( SCIPfreeTransform(scip) );
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/storeexplanations", TRUE) );
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert_gt(scip->conflict->npropcalls, 0, "no conflict was analyzed");
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum), "optimal makespan %g instead of %g",
+      SCIPgetPrimalbound(scip), optimum);
+}
+
+Test(explanation, restart, .description = "check that stored explanations are dropped when the solving process is restarted")
+{
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 50LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", -1LL) );
+   SCIP_CALL( SCIPrestartSolve(scip) );
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+}
@@ -0,0 +1,233 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+/**@file   propagation.c
+ * @brief  unit tests for the time-table and edge-finding propagation of the cumulative constraint handler
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+/* the earliest start times and latest completion times of the groups grow together, which is the worst case for
+ * building the theta tree by insertion in the order of the latest completion times
+ */
+#define NGROUPS 300
+#define GROUPSIZE 3
+#define GROUPLENGTH 10
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+static SCIP_VAR* vars[NGROUPS * GROUPSIZE + 1];
+static int durations[NGROUPS * GROUPSIZE + 1];
+static int demands[NGROUPS * GROUPSIZE + 1];
+static int nvars;
+
+/* TEST SUITE */
+
+static
+void setup(void)
+{
+   nvars = 0;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cumulative") );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   /* only use the propagation algorithm under test */
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/ttinfer", FALSE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/ttefcheck", FALSE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/ttefinfer", FALSE) );
+}
+
+static
+void teardown(void)
+{
+   int v;
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[v]) );
+   }
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** adds a job which has to run within the time window [est,lct) */
+static
+void addJob(
+   const char*           name,               /**< name of the job */
+   int                   est,                /**< earliest start time */
+   int                   lct,                /**< latest completion time */
+   int                   duration,           /**< duration */
+   SCIP_Real             obj                 /**< objective coefficient of the start time */
+   )
+{
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[nvars], name, (SCIP_Real)est, (SCIP_Real)(lct - duration), obj,
+         SCIP_VARTYPE_INTEGER) );
+   SCIP_CALL( SCIPaddVar(scip, vars[nvars]) );
+   durations[nvars] = duration;
+   demands[nvars] = 1;
+   ++nvars;
+}
+
+/** adds the unary cumulative constraint over all jobs */
+static
+void addCumulative(void)
+{
+   SCIP_CONS* cons;
+
+   SCIP_CALL( SCIPcreateConsBasicCumulative(scip, &cons, "cumulative", nvars, vars, durations, demands, 1) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+}
+
+/** adds the groups for edge finding: jobs b and c have to run within [0,5) and job a within [0,10); since a cannot end
+ *  before b and c, edge finding infers that a starts at 4 or later
+ */
+static
+void addEdgeFindingGroups(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int g;
+
+   for( g = 0; g < NGROUPS; ++g )
+   {
+      int offset = GROUPLENGTH * g;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "a%d", g);
+      addJob(name, offset, offset + 10, 2, 1.0);
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "b%d", g);
+      addJob(name, offset, offset + 5, 2, 0.0);
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "c%d", g);
+      addJob(name, offset, offset + 5, 2, 0.0);
+   }
+}
+
+/** adds the groups for time-tabling: job b is fixed to [0,5) and job a has to run within [0,13); the core of b implies
+ *  that a starts at 5 or later
+ */
+static
+void addTimetableGroups(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int g;
+
+   for( g = 0; g < NGROUPS; ++g )
+   {
+      int offset = GROUPLENGTH * g;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "a%d", g);
+      addJob(name, offset, offset + 10, 3, 1.0);
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "b%d", g);
+      addJob(name, offset, offset + 5, 5, 0.0);
+   }
+}
+
+TestSuite(propagation, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(propagation, edgefinding, .description = "check that edge finding infers the start times of all groups in the root node")
+{
+   SCIP_Real optimum = 0.0;
+   int g;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/efcheck", TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/efinfer", TRUE) );
+
+   addEdgeFindingGroups();
+   addCumulative();
+
+   for( g = 0; g < NGROUPS; ++g )
+      optimum += GROUPLENGTH * g + 4;
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum));
+   cr_assert(SCIPisEQ(scip, SCIPgetDualboundRoot(scip), optimum));
+}
+
+Test(propagation, overload, .description = "check that the overload check of edge finding detects infeasibility in the root node")
+{
+   int offset = GROUPLENGTH * (NGROUPS - 1);
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/efcheck", TRUE) );
+
+   /* the last group gets a third job which has to run within [0,5) */
+   addEdgeFindingGroups();
+   addJob("d", offset, offset + 5, 2, 0.0);
+   addCumulative();
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_INFEASIBLE);
+   cr_assert_eq(SCIPgetNNodes(scip), 1);
+}
+
+Test(propagation, timetable, .description = "check that time-tabling infers the start times of all groups in the root node")
+{
+   SCIP_Real optimum = 0.0;
+   int g;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/cumulative/ttinfer", TRUE) );
+
+   addTimetableGroups();
+   addCumulative();
+
+   for( g = 0; g < NGROUPS; ++g )
+      optimum += GROUPLENGTH * g + 5;
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum));
+   cr_assert(SCIPisEQ(scip, SCIPgetDualboundRoot(scip), optimum));
+}
+
+Test(propagation, coreoverload, .description = "check that overlapping cores are detected in the root node")
+{
+   int offset = GROUPLENGTH * (NGROUPS - 1);
+
+   /* the last group gets a second fixed job which overlaps with the fixed job of that group */
+   addTimetableGroups();
+   addJob("d", offset + 2, offset + 6, 4, 0.0);
+   addCumulative();
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_INFEASIBLE);
+   cr_assert_eq(SCIPgetNNodes(scip), 1);
+}
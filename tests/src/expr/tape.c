@@ -0,0 +1,288 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   tape.c
+ * @brief  tests evaluation tapes against the evaluation of the expressions
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "include/scip_test.h"
+
+#define NPOINTS 50
+
+static SCIP* scip;
+static SCIP_VAR* vars[3];
+static SCIP_SOL* sols[NPOINTS];
+static SCIP_RANDNUMGEN* rndgen;
+
+/** expressions that are tested; sin and cos are evaluated by their expression handlers, the others by the tape */
+static const char* inputs[] = {
+   "exp(<x>[C]) * <y>[C]^2 + log(<x>[C] + 3) - 2 * abs(<y>[C]) * <z>[C]",
+   "sin(<x>[C] * <y>[C]) + cos(<z>[C])^2 + signpower(<y>[C], 1.5)",
+   "sin(log(<x>[C])) + <y>[C] * <z>[C]",
+   "<x>[C]^(-2) + cos(<y>[C] + <z>[C]) * <x>[C]",
+   "log(<x>[C]) * (1 + <z>[C]^0.5)"
+};
+
+/** gives the derivative in expr that belongs to var */
+static
+SCIP_Real getPartialDiff(
+   SCIP_EXPR*            expr,
+   SCIP_VAR*             var
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_Real deriv = 0.0;
+
+   SCIP_CALL_ABORT( SCIPcreateExpriter(scip, &it) );
+
+   /* we need to sum-up the derivative value from all expr that represent variable var; but only visit each expr once */
+   for( SCIPexpriterInit(it, expr, SCIP_EXPRITER_DFS, FALSE); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+      if( SCIPisExprVar(scip, expr) && SCIPgetVarExprVar(expr) == var )
+         deriv += SCIPexprGetDerivative(expr);
+
+   SCIPfreeExpriter(&it);
+
+   return deriv;
+}
+
+/** checks whether two values agree, where both may be SCIP_INVALID */
+static
+void checkEqual(
+   SCIP_Real             expected,
+   SCIP_Real             actual
+   )
+{
+   if( expected == SCIP_INVALID ) /*lint !e777*/
+      cr_expect_eq(actual, SCIP_INVALID, "expected invalid value, got %g", actual);
+   else
+      cr_expect(SCIPisRelEQ(scip, expected, actual), "expected %g, got %g", expected, actual);
+}
+
+/* creates scip, variables, and random points; some points are outside of the domain of log */
+static
+void setup(void)
+{
+   int k;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   /* turn off log() and pow() assuming arguments to a away from zero, so that points outside the domain are invalid */
+   SCIP_CALL( SCIPsetRealParam(scip, "expr/log/minzerodistance", 0.0) );
+   SCIP_CALL( SCIPsetRealParam(scip, "expr/pow/minzerodistance", 0.0) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "test_problem") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[0], "x", -2.0, 2.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[1], "y", -2.0, 2.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[2], "z", -2.0, 2.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateRandom(scip, &rndgen, 42, TRUE) );
+
+   for( k = 0; k < NPOINTS; ++k )
+   {
+      SCIP_CALL( SCIPcreateSol(scip, &sols[k], NULL) );
+      for( i = 0; i < 3; ++i )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sols[k], vars[i], SCIPrandomGetReal(rndgen, -2.0, 2.0)) );
+      }
+   }
+}
+
+/* releases points and variables, frees scip */
+static
+void teardown(void)
+{
+   int k;
+   int i;
+
+   for( k = 0; k < NPOINTS; ++k )
+   {
+      SCIP_CALL( SCIPfreeSol(scip, &sols[k]) );
+   }
+   SCIPfreeRandom(scip, &rndgen);
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!!");
+}
+
+Test(tape, eval, .init = setup, .fini = teardown,
+   .description = "check that evaluating a tape gives the same values as SCIPevalExpr()")
+{
+   unsigned int e;
+   int k;
+
+   for( e = 0; e < sizeof(inputs) / sizeof(inputs[0]); ++e )
+   {
+      SCIP_EXPRTAPE* tape;
+      SCIP_EXPR* expr;
+
+      SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)inputs[e], NULL, NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprTape(scip, &tape, expr) );
+
+      for( k = 0; k < NPOINTS; ++k )
+      {
+         SCIP_Real expected;
+
+         SCIP_CALL( SCIPevalExpr(scip, expr, sols[k], 0) );
+         expected = SCIPexprGetEvalValue(expr);
+
+         SCIP_CALL( SCIPevalExprTape(scip, tape, sols[k], 0) );
+         checkEqual(expected, SCIPexprGetEvalValue(expr));
+      }
+
+      SCIP_CALL( SCIPfreeExprTape(scip, &tape) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+   }
+}
+
+Test(tape, gradient, .init = setup, .fini = teardown,
+   .description = "check that the gradient of a tape is the same as the one of SCIPevalExprGradient()")
+{
+   unsigned int e;
+   int k;
+   int i;
+
+   for( e = 0; e < sizeof(inputs) / sizeof(inputs[0]); ++e )
+   {
+      SCIP_EXPRTAPE* tape;
+      SCIP_EXPR* expr;
+
+      SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)inputs[e], NULL, NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprTape(scip, &tape, expr) );
+
+      for( k = 0; k < NPOINTS; ++k )
+      {
+         SCIP_Real expected[3];
+         SCIP_Bool valid;
+
+         SCIP_CALL( SCIPevalExprGradient(scip, expr, sols[k], 0) );
+         valid = SCIPexprGetDerivative(expr) != SCIP_INVALID; /*lint !e777*/
+         for( i = 0; i < 3; ++i )
+            expected[i] = getPartialDiff(expr, vars[i]);
+
+         SCIP_CALL( SCIPevalExprTapeGradient(scip, tape, sols[k], 0) );
+         cr_expect_eq(SCIPexprGetDerivative(expr) != SCIP_INVALID, valid); /*lint !e777*/
+
+         if( !valid )
+            continue;
+
+         for( i = 0; i < 3; ++i )
+            checkEqual(expected[i], getPartialDiff(expr, vars[i]));
+      }
+
+      SCIP_CALL( SCIPfreeExprTape(scip, &tape) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+   }
+}
+
+Test(tape, batch, .init = setup, .fini = teardown,
+   .description = "check that batch evaluation gives the same values and gradients as the point-wise evaluation")
+{
+   SCIP_Real vals[NPOINTS];
+   SCIP_Real grads[3 * NPOINTS];
+   unsigned int e;
+   int k;
+   int i;
+
+   for( e = 0; e < sizeof(inputs) / sizeof(inputs[0]); ++e )
+   {
+      SCIP_EXPR* expr;
+
+      SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)inputs[e], NULL, NULL, NULL) );
+
+      SCIP_CALL( SCIPevalExprBatch(scip, expr, sols, NPOINTS, vals, vars, 3, grads) );
+
+      for( k = 0; k < NPOINTS; ++k )
+      {
+         SCIP_CALL( SCIPevalExpr(scip, expr, sols[k], 0) );
+         checkEqual(SCIPexprGetEvalValue(expr), vals[k]);
+
+         if( vals[k] == SCIP_INVALID ) /*lint !e777*/
+            continue;
+
+         SCIP_CALL( SCIPevalExprGradient(scip, expr, sols[k], 0) );
+
+         if( SCIPexprGetDerivative(expr) == SCIP_INVALID ) /*lint !e777*/
+         {
+            for( i = 0; i < 3; ++i )
+               cr_expect_eq(grads[i * NPOINTS + k], SCIP_INVALID);
+            continue;
+         }
+
+         for( i = 0; i < 3; ++i )
+            checkEqual(getPartialDiff(expr, vars[i]), grads[i * NPOINTS + k]);
+      }
+
+      SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+   }
+}
+
+Test(tape, batchinvalid, .init = setup, .fini = teardown,
+   .description = "check that a point that is invalid before an expression handler call stays invalid in batch evaluation")
+{
+   SCIP_Real vals[NPOINTS];
+   SCIP_EXPR* expr;
+   int ninvalid = 0;
+   int k;
+
+   /* sin() is evaluated by its expression handler, after log() made all points with x <= 0 invalid */
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)"sin(log(<x>[C])) + 1", NULL, NULL, NULL) );
+
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, sols, NPOINTS, vals, NULL, 0, NULL) );
+
+   for( k = 0; k < NPOINTS; ++k )
+   {
+      SCIP_Real xval;
+
+      xval = SCIPgetSolVal(scip, sols[k], vars[0]);
+
+      if( xval <= 0.0 )
+      {
+         cr_expect_eq(vals[k], SCIP_INVALID);
+         ++ninvalid;
+      }
+      else
+         cr_expect(SCIPisRelEQ(scip, vals[k], sin(log(xval)) + 1.0), "expected %g, got %g", sin(log(xval)) + 1.0, vals[k]);
+   }
+
+   /* the random points have to cover both cases */
+   cr_expect_gt(ninvalid, 0);
+   cr_expect_lt(ninvalid, NPOINTS);
+
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+}
@@ -0,0 +1,289 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   checkedsol.c
+ * @brief  unit tests for working solutions with incrementally updated LP row activities
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/heuristics.h"
+#include "scip/struct_heur.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 10
+#define NCONSS 3
+#define NMOVES 500
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+static SCIP_Bool called;
+
+/* TEST SUITE */
+
+/** creates a problem with binary and integer variables and linear constraints, which become global LP rows */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS];
+   char name[SCIP_MAXSTRLEN];
+   int i;
+   int c;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "checkedsol") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, i < NVARS / 2 ? 1.0 : 4.0, (SCIP_Real)(i % 4 - 1),
+            i < NVARS / 2 ? SCIP_VARTYPE_BINARY : SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   for( c = 0; c < NCONSS; ++c )
+   {
+      SCIP_CONS* cons;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "row%d", c);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, 0, NULL, NULL, 2.0, 12.0 + c) );
+      for( i = c; i < NVARS; i += 2 )
+      {
+         SCIP_CALL( SCIPaddCoefLinear(scip, cons, vars[i], (SCIP_Real)((3 * i + c) % 5 + 1)) );
+      }
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   /* no LP is solved; the test heuristic constructs the LP itself */
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+
+   called = FALSE;
+}
+
+/** frees SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** returns the number of LP rows violated by the given solution, counting global or local rows */
+static
+int countViolatedRows(
+   SCIP_SOL*             sol,                /**< solution */
+   SCIP_Bool             local               /**< count local rows instead of global rows? */
+   )
+{
+   SCIP_ROW** rows;
+   int nrows;
+   int nviolated = 0;
+   int r;
+
+   SCIP_CALL_ABORT( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
+   for( r = 0; r < nrows; ++r )
+   {
+      SCIP_Real activity;
+
+      if( SCIProwIsLocal(rows[r]) != local )
+         continue;
+
+      activity = SCIPgetRowSolActivity(scip, rows[r], sol);
+      if( SCIPisFeasLT(scip, activity, SCIProwGetLhs(rows[r])) || SCIPisFeasGT(scip, activity, SCIProwGetRhs(rows[r])) )
+         ++nviolated;
+   }
+
+   return nviolated;
+}
+
+/** compares the incrementally updated data of a checked solution with the values computed from scratch */
+static
+void compareCheckedSol(
+   SCIP_CHECKEDSOL*      checkedsol,         /**< checked solution */
+   SCIP_SOL*             sol                 /**< working solution */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_ROW** rows;
+   SCIP_Real* activities;
+   SCIP_Real obj = 0.0;
+   int nvars;
+   int nrows;
+   int r;
+   int v;
+
+   SCIP_CALL_ABORT( SCIPgetLPRowsData(scip, &rows, &nrows) );
+   activities = SCIPgetCheckedSolRowActivities(checkedsol);
+
+   for( r = 0; r < nrows; ++r )
+   {
+      cr_expect(SCIPisFeasEQ(scip, activities[r], SCIPgetRowSolActivity(scip, rows[r], sol)),
+         "activity of row <%s> is %g instead of %g", SCIProwGetName(rows[r]), activities[r],
+         SCIPgetRowSolActivity(scip, rows[r], sol));
+   }
+
+   cr_expect_eq(SCIPgetCheckedSolNViolRows(checkedsol), countViolatedRows(sol, FALSE));
+   cr_expect_eq(checkedsol->nviollocalrows, countViolatedRows(sol, TRUE));
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+   for( v = 0; v < nvars; ++v )
+      obj += SCIPvarGetObj(vars[v]) * SCIPgetSolVal(scip, sol, vars[v]);
+
+   cr_expect(SCIPisFeasEQ(scip, SCIPgetCheckedSolObj(scip, checkedsol), obj), "objective is %g instead of %g",
+      SCIPgetCheckedSolObj(scip, checkedsol), obj);
+}
+
+/** performs random moves on a checked solution and tries it, once with an additional local row in probing mode */
+static
+SCIP_DECL_HEUREXEC(heurExecCheckedSol)
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_CHECKEDSOL* checkedsol;
+   SCIP_VAR** vars;
+   SCIP_ROW* localrow;
+   SCIP_SOL* sol;
+   SCIP_Bool cutoff;
+   SCIP_Bool stored;
+   int nvars;
+   int nsols;
+   int m;
+   int v;
+
+   *result = SCIP_DIDNOTFIND;
+
+   if( called )
+      return SCIP_OKAY;
+   called = TRUE;
+
+   /* the columns of the LP know their rows only after the LP was flushed */
+   SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
+   cr_assert_not(cutoff);
+   SCIP_CALL( SCIPflushLP(scip) );
+   cr_assert_eq(SCIPgetNLPRows(scip), NCONSS);
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+   SCIP_CALL( SCIPcreateSol(scip, &sol, heur) );
+
+   /* random moves keep the activities, the number of violated rows, and the objective up to date */
+   SCIP_CALL( SCIPcreateCheckedSol(scip, &checkedsol, sol) );
+   compareCheckedSol(checkedsol, sol);
+
+   for( m = 0; m < NMOVES; ++m )
+   {
+      SCIP_VAR* var = vars[SCIPrandomGetInt(randnumgen, 0, nvars - 1)];
+
+      SCIP_CALL( SCIPsetCheckedSolVal(scip, checkedsol, var,
+            (SCIP_Real)SCIPrandomGetInt(randnumgen, 0, (int)SCIPvarGetUbGlobal(var))) );
+      compareCheckedSol(checkedsol, sol);
+   }
+
+   /* an infeasible solution is rejected and a feasible one is stored */
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPsetCheckedSolVal(scip, checkedsol, vars[v], 0.0) );
+   }
+   cr_expect_gt(SCIPgetCheckedSolNViolRows(checkedsol), 0);
+
+   nsols = SCIPgetNSolsFound(scip);
+   SCIP_CALL( SCIPtryCheckedSol(scip, checkedsol, FALSE, FALSE, TRUE, TRUE, &stored) );
+   cr_expect_not(stored);
+   cr_expect_eq(SCIPgetNSolsFound(scip), nsols);
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPsetCheckedSolVal(scip, checkedsol, vars[v], SCIPvarGetUbGlobal(vars[v]) > 1.5 ? 1.0 : 0.0) );
+   }
+   cr_expect_eq(SCIPgetCheckedSolNViolRows(checkedsol), 0);
+
+   SCIP_CALL( SCIPtryCheckedSol(scip, checkedsol, FALSE, FALSE, TRUE, TRUE, &stored) );
+   cr_expect(stored);
+   SCIPfreeCheckedSol(scip, &checkedsol);
+
+   /* a violated local row does not reject the solution, since it does not belong to a global constraint */
+   SCIP_CALL( SCIPstartProbing(scip) );
+   SCIP_CALL( SCIPcreateEmptyRowUnspec(scip, &localrow, "local", -SCIPinfinity(scip), 0.0, TRUE, FALSE, FALSE) );
+   SCIP_CALL( SCIPaddVarToRow(scip, localrow, vars[nvars - 1], 1.0) );
+   SCIP_CALL( SCIPaddRowProbing(scip, localrow) );
+   SCIP_CALL( SCIPflushLP(scip) );
+
+   SCIP_CALL( SCIPcreateCheckedSol(scip, &checkedsol, sol) );
+   compareCheckedSol(checkedsol, sol);
+   cr_expect_eq(checkedsol->nviollocalrows, 1);
+
+   SCIP_CALL( SCIPsetCheckedSolVal(scip, checkedsol, vars[nvars - 1], 0.0) );
+   compareCheckedSol(checkedsol, sol);
+   cr_expect_eq(checkedsol->nviollocalrows, 0);
+
+   SCIP_CALL( SCIPsetCheckedSolVal(scip, checkedsol, vars[nvars - 1], 2.0) );
+   cr_expect_eq(checkedsol->nviollocalrows, 1);
+
+   SCIP_CALL( SCIPtryCheckedSol(scip, checkedsol, FALSE, FALSE, TRUE, TRUE, &stored) );
+   cr_expect_eq(SCIPgetCheckedSolNViolRows(checkedsol), 0);
+
+   SCIPfreeCheckedSol(scip, &checkedsol);
+   SCIP_CALL( SCIPreleaseRow(scip, &localrow) );
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIPfreeRandom(scip, &randnumgen);
+
+   return SCIP_OKAY;
+}
+
+TestSuite(checkedsol, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(checkedsol, moves, .description = "check the incremental LP row activities, violations, and objective of a checked solution")
+{
+   SCIP_HEUR* heur;
+
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur, "checkedsol", "random moves on a checked solution", 'X', 0, 1, 0, -1,
+         SCIP_HEURTIMING_AFTERNODE, FALSE, heurExecCheckedSol, NULL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert(called);
+   cr_expect_geq(SCIPgetNSols(scip), 1);
+}
@@ -233,6 +233,10 @@ Test(heuristic, improvePoint, .init = setup, .fini = teardown,
    vars[0] = x;
    vars[1] = y;
 
+   /* improvePoint() expects the minimum feasibility of the start point, which is computed with getMinFeas() before
+    * each call
+    */
+
    /* for one linear constraint the method should stop after one iteration (if the projection on the linear constraint
     * is not outside the domain)
     */
@@ -240,6 +244,7 @@ Test(heuristic, improvePoint, .init = setup, .fini = teardown,
    lincoefs[1] = 1.0;
    SCIP_CALL( SCIPcreateNlRow(scip, &nlrows[0], "nlrow1", 0.0, 2, vars, lincoefs, NULL, 1.0, 1.0,
          SCIP_EXPRCURV_UNKNOWN) );
+   SCIP_CALL( getMinFeas(scip, nlrows, 1, sol, &minfeas) );
    SCIP_CALL( improvePoint(scip, nlrows, 1, varindex, sol, 1, 0.0, INT_MAX, &minfeas, nlrowgradcosts, &gradcosts) );
    cr_expect(SCIPisFeasEQ(scip, minfeas, 0.0));
    cr_expect(gradcosts > 0.0);
@@ -252,6 +257,7 @@ Test(heuristic, improvePoint, .init = setup, .fini = teardown,
    /* start inside the ball */
    SCIP_CALL( SCIPsetSolVal(scip, sol, x, 0.1) );
    SCIP_CALL( SCIPsetSolVal(scip, sol, y, 0.2) );
+   SCIP_CALL( getMinFeas(scip, &nlrows[1], 1, sol, &minfeas) );
    SCIP_CALL( improvePoint(scip, &nlrows[1], 1, varindex, sol, 10, 0.0, INT_MAX, &minfeas, nlrowgradcosts, &gradcosts) );
    cr_expect(SCIPisFeasGE(scip, minfeas, -EPS), "expecting minfeas %g > -eps (%g)\n", minfeas, -EPS);
    cr_expect(gradcosts > 0.0);
@@ -259,6 +265,7 @@ Test(heuristic, improvePoint, .init = setup, .fini = teardown,
    /* start outside the ball */
    SCIP_CALL( SCIPsetSolVal(scip, sol, x, 1.0) );
    SCIP_CALL( SCIPsetSolVal(scip, sol, y, 5.0) );
+   SCIP_CALL( getMinFeas(scip, &nlrows[1], 1, sol, &minfeas) );
    SCIP_CALL( improvePoint(scip, &nlrows[1], 1, varindex, sol, 100, 0.0, INT_MAX, &minfeas, nlrowgradcosts, &gradcosts) );
    cr_expect(SCIPisFeasGE(scip, minfeas, -EPS), "expecting minfeas %g > -eps (%g)\n", minfeas, -EPS);
    cr_expect(gradcosts > 0.0);
@@ -266,6 +273,7 @@ Test(heuristic, improvePoint, .init = setup, .fini = teardown,
    /* consider linear and quadratic constraint */
    SCIP_CALL( SCIPsetSolVal(scip, sol, x, -1.0) );
    SCIP_CALL( SCIPsetSolVal(scip, sol, y, -10.0) );
+   SCIP_CALL( getMinFeas(scip, nlrows, 2, sol, &minfeas) );
    SCIP_CALL( improvePoint(scip, nlrows, 2, varindex, sol, 100, 0.0, INT_MAX, &minfeas, nlrowgradcosts, &gradcosts) );
    cr_expect(SCIPisFeasGE(scip, minfeas, -EPS), "expecting minfeas %g > -eps (%g)\n", minfeas, -EPS);
    cr_expect(gradcosts > 0.0);
@@ -299,6 +307,81 @@ Test(heuristic, filterPoints, .init = setup, .fini = teardown,
       cr_assert(feasibilities[i] >= feasibilities[i+1]);
 }
 
+Test(heuristic, getMinFeasBatch, .init = setup, .fini = teardown,
+   .description = "check that getMinFeasBatch() of the multi-start heuristic agrees with getMinFeas() and reuses its tapes"
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_EXPRTAPE* tapes[2];
+   SCIP_NLROW* nlrows[2];
+   SCIP_SOL* points[21];
+   SCIP_Real feasibilities[21];
+   SCIP_VAR* linvars[2];
+   SCIP_Real lincoefs[2];
+   SCIP_EXPR* expr;
+   int i;
+
+   heurdata = SCIPheurGetData(heurmultistart);
+   cr_assert(heurdata != NULL);
+
+   linvars[0] = x;
+   linvars[1] = y;
+   lincoefs[0] = 2.3;
+   lincoefs[1] = -3.1;
+
+   /* -1 <= 2.3*x - 3.1*y + x*exp(y) <= 1 and x^2 + sin(y) <= 0.5 */
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)"<t_x> * exp(<t_y>)", NULL, NULL, NULL) );
+   SCIP_CALL( SCIPcreateNlRow(scip, &nlrows[0], "nlrow0", 0.0, 2, linvars, lincoefs, expr, -1.0, 1.0,
+         SCIP_EXPRCURV_UNKNOWN) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)"<t_x>^2 + sin(<t_y>)", NULL, NULL, NULL) );
+   SCIP_CALL( SCIPcreateNlRow(scip, &nlrows[1], "nlrow1", 0.0, 0, NULL, NULL, expr, -SCIPinfinity(scip), 0.5,
+         SCIP_EXPRCURV_UNKNOWN) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+
+   /* create solutions with random values and one solution with an unknown value */
+   for( i = 0; i < 21; ++i )
+   {
+      SCIP_CALL( SCIPcreateSol(scip, &points[i], NULL) );
+      SCIP_CALL( SCIPsetSolVal(scip, points[i], x, SCIPrandomGetReal(randumgen, -1.0, 1.0)) );
+      SCIP_CALL( SCIPsetSolVal(scip, points[i], y, i < 20 ? SCIPrandomGetReal(randumgen, -10.0, 10.0) : SCIP_UNKNOWN) );
+   }
+
+   SCIP_CALL( getMinFeasBatch(scip, heurdata, nlrows, 2, points, 21, feasibilities) );
+
+   for( i = 0; i < 20; ++i )
+   {
+      SCIP_Real minfeas;
+
+      SCIP_CALL( getMinFeas(scip, nlrows, 2, points[i], &minfeas) );
+      cr_assert(SCIPisRelEQ(scip, feasibilities[i], minfeas), "expecting %g, got %g\n", minfeas, feasibilities[i]);
+   }
+
+   /* a row with an unknown value is infeasible, as in SCIPgetNlRowSolActivity() */
+   cr_assert(feasibilities[20] < 0.0);
+
+   /* the tapes are kept for the next call */
+   cr_assert(heurdata->nlrowtapes != NULL);
+   tapes[0] = (SCIP_EXPRTAPE*)SCIPhashmapGetImage(heurdata->nlrowtapes, (void*)nlrows[0]);
+   tapes[1] = (SCIP_EXPRTAPE*)SCIPhashmapGetImage(heurdata->nlrowtapes, (void*)nlrows[1]);
+   cr_assert(tapes[0] != NULL && tapes[1] != NULL);
+
+   SCIP_CALL( getMinFeasBatch(scip, heurdata, nlrows, 2, points, 20, feasibilities) );
+   cr_assert(SCIPhashmapGetImage(heurdata->nlrowtapes, (void*)nlrows[0]) == tapes[0]);
+   cr_assert(SCIPhashmapGetImage(heurdata->nlrowtapes, (void*)nlrows[1]) == tapes[1]);
+
+   SCIP_CALL( freeNlRowTapes(scip, heurdata) );
+   cr_assert(heurdata->nlrowtapes == NULL);
+
+   for( i = 20; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPfreeSol(scip, &points[i]) );
+   }
+   SCIP_CALL( SCIPreleaseNlRow(scip, &nlrows[1]) );
+   SCIP_CALL( SCIPreleaseNlRow(scip, &nlrows[0]) );
+}
+
 #define NPOINTS 100
 Test(heuristic, clusterPointsGreedy, .init = setup, .fini = teardown,
    .description = "check clusterPointsGreedy subroutine of the multi-start heuristic"
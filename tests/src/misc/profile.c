@@ -0,0 +1,190 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+/**@file   profile.c
+ * @brief  unittest for the resource profile in misc.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+
+#include "include/scip_test.h"
+
+#define NCORES 200
+#define CAPACITY 1000
+
+static SCIP* scip;
+static SCIP_RANDNUMGEN* randnumgen;
+static SCIP_PROFILE* profile;
+static SCIP_PROFILE* reference;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+   SCIP_CALL( SCIPprofileCreate(&profile, CAPACITY) );
+   SCIP_CALL( SCIPprofileCreate(&reference, CAPACITY) );
+}
+
+static
+void teardown(void)
+{
+   SCIPprofileFree(&reference);
+   SCIPprofileFree(&profile);
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** checks that both resource profiles have the same time points and loads */
+static
+void checkSameProfile(void)
+{
+   int t;
+
+   cr_assert_eq(SCIPprofileGetNTimepoints(profile), SCIPprofileGetNTimepoints(reference));
+
+   for( t = 0; t < SCIPprofileGetNTimepoints(profile); ++t )
+   {
+      cr_expect_eq(SCIPprofileGetTime(profile, t), SCIPprofileGetTime(reference, t));
+      cr_expect_eq(SCIPprofileGetLoad(profile, t), SCIPprofileGetLoad(reference, t));
+   }
+}
+
+/** creates random cores within [0,500) with demands in [0,maxdemand] */
+static
+void createCores(
+   int*                  lefts,
+   int*                  rights,
+   int*                  demands,
+   int                   ncores,
+   int                   maxdemand
+   )
+{
+   int c;
+
+   for( c = 0; c < ncores; ++c )
+   {
+      lefts[c] = SCIPrandomGetInt(randnumgen, 0, 498);
+      rights[c] = SCIPrandomGetInt(randnumgen, lefts[c] + 1, 499);
+      demands[c] = SCIPrandomGetInt(randnumgen, 0, maxdemand);
+   }
+}
+
+TestSuite(profile, .init = setup, .fini = teardown);
+
+Test(profile, insertcores, .description = "test that inserting cores at once gives the same profile as inserting them one by one")
+{
+   int lefts[NCORES];
+   int rights[NCORES];
+   int demands[NCORES];
+   SCIP_Bool infeasible;
+   int pos;
+   int c;
+
+   /* insert some cores before, such that the cores are merged into an existing profile */
+   createCores(lefts, rights, demands, NCORES / 2, 5);
+   for( c = 0; c < NCORES / 2; ++c )
+   {
+      SCIP_CALL( SCIPprofileInsertCore(profile, lefts[c], rights[c], demands[c], &pos, &infeasible) );
+      cr_assert_not(infeasible);
+      SCIP_CALL( SCIPprofileInsertCore(reference, lefts[c], rights[c], demands[c], &pos, &infeasible) );
+      cr_assert_not(infeasible);
+   }
+
+   createCores(lefts, rights, demands, NCORES, 5);
+   for( c = 0; c < NCORES; ++c )
+   {
+      SCIP_CALL( SCIPprofileInsertCore(reference, lefts[c], rights[c], demands[c], &pos, &infeasible) );
+      cr_assert_not(infeasible);
+   }
+
+   SCIP_CALL( SCIPprofileInsertCores(profile, NCORES, lefts, rights, demands, &infeasible) );
+   cr_assert_not(infeasible);
+
+   checkSameProfile();
+
+   /* the cores can be deleted one by one again; cores without demand are not part of the profile */
+   for( c = 0; c < NCORES; ++c )
+   {
+      if( demands[c] == 0 )
+         continue;
+
+      SCIP_CALL( SCIPprofileDeleteCore(profile, lefts[c], rights[c], demands[c]) );
+      SCIP_CALL( SCIPprofileDeleteCore(reference, lefts[c], rights[c], demands[c]) );
+   }
+
+   checkSameProfile();
+}
+
+Test(profile, insertcoresinfeasible, .description = "test that cores which do not fit together do not change the profile")
+{
+   int lefts[NCORES];
+   int rights[NCORES];
+   int demands[NCORES];
+   SCIP_Bool infeasible;
+   int pos;
+   int c;
+
+   createCores(lefts, rights, demands, NCORES, 5);
+   SCIP_CALL( SCIPprofileInsertCores(profile, NCORES, lefts, rights, demands, &infeasible) );
+   cr_assert_not(infeasible);
+
+   for( c = 0; c < NCORES; ++c )
+   {
+      SCIP_CALL( SCIPprofileInsertCore(reference, lefts[c], rights[c], demands[c], &pos, &infeasible) );
+      cr_assert_not(infeasible);
+   }
+
+   /* the last core exceeds the capacity on its own */
+   createCores(lefts, rights, demands, NCORES, 5);
+   demands[NCORES - 1] = CAPACITY;
+
+   SCIP_CALL( SCIPprofileInsertCores(profile, NCORES, lefts, rights, demands, &infeasible) );
+   cr_assert(infeasible);
+
+   checkSameProfile();
+}
+
+Test(profile, insertcoresempty, .description = "test that inserting no cores or cores without demand does not change the profile")
+{
+   int left = 3;
+   int right = 7;
+   int demand = 0;
+   SCIP_Bool infeasible;
+
+   SCIP_CALL( SCIPprofileInsertCores(profile, 0, NULL, NULL, NULL, &infeasible) );
+   cr_assert_not(infeasible);
+
+   SCIP_CALL( SCIPprofileInsertCores(profile, 1, &left, &right, &demand, &infeasible) );
+   cr_assert_not(infeasible);
+
+   cr_assert_eq(SCIPprofileGetNTimepoints(profile), 1);
+   cr_assert_eq(SCIPprofileGetLoad(profile, 0), 0);
+}
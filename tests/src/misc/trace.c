@@ -0,0 +1,224 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   trace.c
+ * @brief  unit tests for the trace of the solving process
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_scip.h"
+#include "scip/struct_stat.h"
+#include "scip/struct_trace.h"
+
+#include "include/scip_test.h"
+
+#define TRACEFILE "trace_unittest.json"
+#define NVARS 12
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+
+/* TEST SUITE */
+
+/** creates a small knapsack problem that is solved by branching, so that no LP solver is needed */
+static
+void setup(void)
+{
+   SCIP_CONS* cons;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "trace") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", 0, NULL, NULL, -SCIPinfinity(scip), 27.0) );
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, 1.0, (SCIP_Real)(i % 5 + 3), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, (SCIP_Real)(i % 7 + 2)) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "timing/trace", TRUE) );
+}
+
+/** frees SCIP and removes the trace file */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+   (void) remove(TRACEFILE);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** number of focused nodes and maximal trace depth when a node was focused after timing/trace was switched off */
+static int nfocusednodes;
+static int maxfocusdepth;
+static SCIP_Bool traceoff;
+
+/** catches node focus events */
+static
+SCIP_DECL_EVENTINITSOL(eventInitsolFocus)
+{
+   nfocusednodes = 0;
+   maxfocusdepth = 0;
+   traceoff = FALSE;
+
+   SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODEFOCUSED, eventhdlr, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
+
+/** records the trace depth at nodes that are focused after timing/trace was switched off; no events are open then */
+static
+SCIP_DECL_EVENTEXEC(eventExecFocus)
+{
+   if( traceoff )
+   {
+      maxfocusdepth = MAX(maxfocusdepth, scip->stat->trace->depth);
+      ++nfocusednodes;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** switches timing/trace off while the heuristic call and the processing of the node are traced */
+static
+SCIP_DECL_HEUREXEC(heurExecTraceOff)
+{
+   *result = SCIP_DIDNOTFIND;
+
+   if( !traceoff )
+   {
+      SCIP_CALL( SCIPsetBoolParam(scip, "timing/trace", FALSE) );
+      traceoff = TRUE;
+   }
+
+   return SCIP_OKAY;
+}
+
+TestSuite(trace, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(trace, write, .description = "check that a solve writes node events to the trace file")
+{
+   char line[SCIP_MAXSTRLEN];
+   SCIP_Bool hasheader = FALSE;
+   SCIP_Bool hasnode = FALSE;
+   FILE* file;
+
+   SCIP_CALL( SCIPsetStringParam(scip, "timing/tracefilename", TRACEFILE) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert_not_null(scip->stat->trace->events);
+
+   /* the trace is written and the ring buffer is released when the solving process data is freed */
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   cr_expect_null(scip->stat->trace->events);
+   cr_expect_eq(scip->stat->trace->depth, 0);
+
+   file = fopen(TRACEFILE, "r");
+   cr_assert_not_null(file, "trace file was not written");
+
+   while( fgets(line, (int) sizeof(line), file) != NULL )
+   {
+      if( strstr(line, "\"traceEvents\"") != NULL )
+         hasheader = TRUE;
+      if( strstr(line, "\"cat\":\"node\"") != NULL )
+         hasnode = TRUE;
+   }
+   fclose(file);
+
+   cr_expect(hasheader);
+   cr_expect(hasnode);
+}
+
+Test(trace, subscip, .description = "check that a sub-SCIP that inherits timing/trace does not record events")
+{
+   SCIP* subscip;
+   SCIP_Bool valid;
+   SCIP_Bool trace;
+
+   SCIP_CALL( SCIPcreate(&subscip) );
+   SCIP_CALL( SCIPcopy(scip, subscip, NULL, NULL, "sub", TRUE, FALSE, FALSE, FALSE, &valid) );
+
+   SCIP_CALL( SCIPgetBoolParam(subscip, "timing/trace", &trace) );
+   cr_assert(trace);
+   cr_assert_gt(SCIPgetSubscipDepth(subscip), 0);
+
+   SCIP_CALL( SCIPsetIntParam(subscip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPtransformProb(subscip) );
+   SCIP_CALL( SCIPpresolve(subscip) );
+
+   cr_expect_not(subscip->stat->trace->active);
+
+   SCIP_CALL( SCIPsolve(subscip) );
+
+   cr_expect_eq(subscip->stat->trace->nevents, 0);
+   cr_expect_null(subscip->stat->trace->events);
+
+   SCIP_CALL( SCIPfree(&subscip) );
+}
+
+Test(trace, toggle, .description = "check that switching timing/trace off during the solve keeps the nesting of events")
+{
+   SCIP_EVENTHDLR* eventhdlr;
+   SCIP_HEUR* heur;
+
+   /* disable presolving, so that all nodes are in the same run, and the default heuristics */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, "focus", "records the trace depth at focused nodes",
+         eventExecFocus, NULL) );
+   SCIP_CALL( SCIPsetEventhdlrInitsol(scip, eventhdlr, eventInitsolFocus) );
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur, "traceoff", "switches timing/trace off", 'X', 0, 1, 0, -1,
+         SCIP_HEURTIMING_AFTERNODE, FALSE, heurExecTraceOff, NULL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   cr_assert(traceoff);
+   cr_assert_gt(nfocusednodes, 0, "no nodes left to check the nesting");
+   cr_expect_eq(maxfocusdepth, 0, "%d trace events are still open", maxfocusdepth);
+}
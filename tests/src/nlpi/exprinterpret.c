@@ -521,6 +521,117 @@ Test(checkad, griewank)
    SCIP_CALL( SCIPreleaseExpr(scip, &exprsum) );
 }
 
+/* computes value, gradient, and dense lower-triangular Hessian of an expression in varidx expressions with an expression interpreter */
+static
+void computeDerivatives(
+   SCIP_EXPRINT*         interpreter,        /**< expression interpreter */
+   SCIP_EXPR*            expr,               /**< expression in varidx expressions */
+   SCIP_Real*            point,              /**< values of variables */
+   SCIP_Real*            val,                /**< buffer to store function value */
+   SCIP_Real*            gradient,           /**< array of size nvars to store gradient */
+   SCIP_Real*            hessian             /**< array of size nvars*nvars to store Hessian */
+   )
+{
+   SCIP_EXPRINTDATA* exprintdata = NULL;
+   SCIP_Real* hesvalues;
+   int* hesrowidx;
+   int* hescolidx;
+   int hesnnz;
+   int i;
+
+   BMSclearMemoryArray(gradient, nvars);
+   BMSclearMemoryArray(hessian, nvars * nvars);
+
+   SCIP_CALL( SCIPexprintCompile(scip, interpreter, expr, &exprintdata) );
+   SCIP_CALL( SCIPexprintGrad(scip, interpreter, expr, exprintdata, point, TRUE, val, gradient) );
+
+   if( SCIPexprintGetExprCapability(scip, interpreter, expr, exprintdata) & SCIP_EXPRINTCAPABILITY_HESSIAN )
+   {
+      SCIP_CALL( SCIPexprintHessianSparsity(scip, interpreter, expr, exprintdata, point, &hesrowidx, &hescolidx, &hesnnz) );
+      SCIP_CALL( SCIPexprintHessian(scip, interpreter, expr, exprintdata, point, FALSE, val, &hesrowidx, &hescolidx, &hesvalues, &hesnnz) );
+
+      for( i = 0; i < hesnnz; ++i )
+      {
+         cr_assert(hescolidx[i] <= hesrowidx[i]);
+         hessian[hesrowidx[i] * nvars + hescolidx[i]] += hesvalues[i];
+      }
+   }
+
+   SCIP_CALL( SCIPexprintFreeData(scip, interpreter, expr, &exprintdata) );
+}
+
+/* checks that expressions that share their structure with a previously compiled expression, and thus reuse its tape,
+ * Hessian sparsity, and coloring, give the same value and derivatives as with an interpreter without cache
+ *
+ * The cache is keyed by the structure up to renumbering of variables, so expressions that differ only in exponents,
+ * coefficients, or in the order of the variables must not share their data.
+ */
+Test(checkad, cache)
+{
+   SCIP_EXPRINT* nocacheexprint;
+   SCIP_EXPR* exprs[5];
+   SCIP_Real val;
+   SCIP_Real gradient[nvars];
+   SCIP_Real hessian[nvars * nvars];
+   SCIP_Real nocacheval;
+   SCIP_Real nocachegradient[nvars];
+   SCIP_Real nocachehessian[nvars * nvars];
+   const char* inputs[5] = {
+      "<x0>^2 * <x1> + exp(<x2>) * sin(<x1>)",
+      "<x3>^2 * <x5> + exp(<x7>) * sin(<x5>)",
+      "<x3>^3 * <x5> + exp(<x7>) * sin(<x5>)",
+      "<x5>^2 * <x3> + exp(<x7>) * sin(<x3>)",
+      "2 * <x4>^2 * <x6> + exp(<x9>) * sin(<x6>)"
+   };
+   int e;
+   int i;
+
+   if( !(SCIPexprintGetCapability() & SCIP_EXPRINTCAPABILITY_GRADIENT) )
+      return;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "nlp/exprintcachesize", 0) );
+   SCIP_CALL( SCIPexprintCreate(scip, &nocacheexprint) );
+   SCIP_CALL( SCIPresetParam(scip, "nlp/exprintcachesize") );
+
+   for( i = 0; i < nvars; ++i )
+      varvals[0][i] = 0.1 * (i + 1);
+   SCIP_CALL( SCIPsetSolVals(scip, sol, nvars, vars, varvals[0]) );
+
+   for( e = 0; e < 5; ++e )
+   {
+      SCIP_EXPR* expr;
+
+      SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)inputs[e], NULL, NULL, NULL) );
+      SCIP_CALL( SCIPduplicateExpr(scip, expr, &exprs[e], mapvar, NULL, NULL, NULL) );
+
+      /* the value computed with cached data has to agree with the one of the expression handlers */
+      SCIP_CALL( SCIPevalExpr(scip, expr, sol, ++soltag) );
+      computeDerivatives(exprint, exprs[e], varvals[0], &val, gradient, hessian);
+      cr_expect_float_eq(val, SCIPexprGetEvalValue(expr), TOL, "expression %d", e);
+
+      SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+   }
+
+   /* the derivatives computed with cached data have to agree with the ones of an interpreter without cache */
+   for( e = 0; e < 5; ++e )
+   {
+      computeDerivatives(exprint, exprs[e], varvals[0], &val, gradient, hessian);
+      computeDerivatives(nocacheexprint, exprs[e], varvals[0], &nocacheval, nocachegradient, nocachehessian);
+
+      cr_expect_float_eq(val, nocacheval, TOL, "expression %d", e);
+      for( i = 0; i < nvars; ++i )
+         cr_expect_float_eq(gradient[i], nocachegradient[i], TOL, "expression %d, gradient entry %d", e, i);
+      for( i = 0; i < nvars * nvars; ++i )
+         cr_expect_float_eq(hessian[i], nocachehessian[i], TOL, "expression %d, Hessian entry %d", e, i);
+   }
+
+   for( e = 4; e >= 0; --e )
+   {
+      SCIP_CALL( SCIPreleaseExpr(scip, &exprs[e]) );
+   }
+   SCIPexprintFree(scip, &nocacheexprint);
+}
+
 /* for testing, keep these numbers down
  * but to check timing, set these numbers higher
  */
@@ -0,0 +1,141 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   partialpricing.c
+ * @brief  unit test for stopping pricing rounds early via pricing/partialvars
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_CONS* cover;
+static int ncolumns;
+static SCIP_Bool enoughvars;
+
+/** adds a cheaper column to the covering constraint in the first call, nothing afterwards */
+static
+SCIP_DECL_PRICERREDCOST(pricerRedcostFirst)
+{  /*lint --e{715}*/
+   SCIP_VAR* var;
+
+   *result = SCIP_SUCCESS;
+
+   if( ncolumns > 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &var, "priced", 0.0, SCIPinfinity(scip), 1.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddPricedVar(scip, var, 1.0) );
+   SCIP_CALL( SCIPaddCoefLinear(scip, cover, var, 1.0) );
+   SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   ++ncolumns;
+
+   enoughvars = SCIPhasEnoughPricedVars(scip);
+
+   return SCIP_OKAY;
+}
+
+/** never finds a column */
+static
+SCIP_DECL_PRICERREDCOST(pricerRedcostSecond)
+{  /*lint --e{715}*/
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+static
+void setup(void)
+{
+   SCIP_VAR* var;
+   SCIP_Real one = 1.0;
+
+   ncolumns = 0;
+   enoughvars = FALSE;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "partialpricing") );
+
+   SCIP_CALL( SCIPincludePricerBasic(scip, NULL, "first", "pricer that finds one column", 1, FALSE,
+         pricerRedcostFirst, NULL, NULL) );
+   SCIP_CALL( SCIPincludePricerBasic(scip, NULL, "second", "pricer that finds no column", 0, FALSE,
+         pricerRedcostSecond, NULL, NULL) );
+   SCIP_CALL( SCIPactivatePricer(scip, SCIPfindPricer(scip, "first")) );
+   SCIP_CALL( SCIPactivatePricer(scip, SCIPfindPricer(scip, "second")) );
+
+   /* min 10 x s.t. x >= 1, where the pricer adds a cheaper copy of x */
+   SCIP_CALL( SCIPcreateVarBasic(scip, &var, "x", 0.0, SCIPinfinity(scip), 10.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, var) );
+   SCIP_CALL( SCIPcreateConsLinear(scip, &cover, "cover", 1, &var, &one, 1.0, SCIPinfinity(scip),
+         TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, FALSE, FALSE, FALSE) );
+   SCIP_CALL( SCIPaddCons(scip, cover) );
+   SCIP_CALL( SCIPreleaseVar(scip, &var) );
+
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPreleaseCons(scip, &cover) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+Test(partialpricing, fullrounds, .init = setup, .fini = teardown,
+   .description = "without partial pricing, all pricers are called in every round")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 1.0));
+   cr_assert_eq(ncolumns, 1);
+   cr_assert(!enoughvars);
+   cr_assert_eq(SCIPpricerGetNCalls(SCIPfindPricer(scip, "second")), SCIPpricerGetNCalls(SCIPfindPricer(scip, "first")));
+}
+
+Test(partialpricing, stopearly, .init = setup, .fini = teardown,
+   .description = "with partial pricing, the second pricer is skipped once a column was found")
+{
+   SCIP_CALL( SCIPsetIntParam(scip, "pricing/partialvars", 1) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 1.0));
+   cr_assert_eq(ncolumns, 1);
+   cr_assert(enoughvars);
+
+   /* the round in which the column was found stops after the first pricer */
+   cr_assert_eq(SCIPpricerGetNCalls(SCIPfindPricer(scip, "second")),
+      SCIPpricerGetNCalls(SCIPfindPricer(scip, "first")) - 1);
+}
@@ -0,0 +1,165 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   smoothing.c
+ * @brief  unit test for dual smoothing in the pricing loop via pricing/smoothing
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_pricestore.h"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NCOLUMNS 5
+
+static SCIP* scip;
+static SCIP_CONS* cover;
+static SCIP_Bool added[NCOLUMNS];
+static const SCIP_Real costs[NCOLUMNS] = {8.0, 6.0, 4.0, 2.0, 1.0};
+static int ncalls;
+static int nsmoothed;
+static int nbelow;
+
+/** adds the most expensive column of the catalog whose cost is below the pricing dual of the covering row */
+static
+SCIP_DECL_PRICERREDCOST(pricerRedcostCatalog)
+{  /*lint --e{715}*/
+   SCIP_ROW* row;
+   SCIP_Real lpdual;
+   SCIP_Real dual;
+   int k;
+
+   *result = SCIP_SUCCESS;
+   ++ncalls;
+
+   row = SCIPgetRowLinear(scip, cover);
+   cr_assert_not_null(row);
+
+   lpdual = SCIProwGetDualsol(row);
+   dual = SCIPgetRowPricingDualsol(scip, row);
+
+   if( !SCIPisEQ(scip, dual, lpdual) )
+      ++nsmoothed;
+
+   /* the LP dual only decreases, so the smoothed dual is never below it */
+   if( SCIPisLT(scip, dual, lpdual) )
+      ++nbelow;
+
+   for( k = 0; k < NCOLUMNS; ++k )
+   {
+      if( !added[k] && SCIPisLT(scip, costs[k], dual) )
+      {
+         SCIP_VAR* var;
+         char name[SCIP_MAXSTRLEN];
+
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "col%d", k);
+         SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, SCIPinfinity(scip), costs[k], SCIP_VARTYPE_CONTINUOUS) );
+         SCIP_CALL( SCIPaddPricedVar(scip, var, 1.0) );
+         SCIP_CALL( SCIPaddCoefLinear(scip, cover, var, 1.0) );
+         SCIP_CALL( SCIPreleaseVar(scip, &var) );
+         added[k] = TRUE;
+         break;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+static
+void setup(void)
+{
+   SCIP_VAR* var;
+   SCIP_Real one = 1.0;
+   int k;
+
+   for( k = 0; k < NCOLUMNS; ++k )
+      added[k] = FALSE;
+   ncalls = 0;
+   nsmoothed = 0;
+   nbelow = 0;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "smoothing") );
+
+   SCIP_CALL( SCIPincludePricerBasic(scip, NULL, "catalog", "pricer that adds columns of a catalog", 0, FALSE,
+         pricerRedcostCatalog, NULL, NULL) );
+   SCIP_CALL( SCIPactivatePricer(scip, SCIPfindPricer(scip, "catalog")) );
+
+   /* min 10 x s.t. x >= 1, where the pricer adds cheaper copies of x */
+   SCIP_CALL( SCIPcreateVarBasic(scip, &var, "x", 0.0, SCIPinfinity(scip), 10.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, var) );
+   SCIP_CALL( SCIPcreateConsLinear(scip, &cover, "cover", 1, &var, &one, 1.0, SCIPinfinity(scip),
+         TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, FALSE, FALSE, FALSE) );
+   SCIP_CALL( SCIPaddCons(scip, cover) );
+   SCIP_CALL( SCIPreleaseVar(scip, &var) );
+
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPreleaseCons(scip, &cover) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+Test(smoothing, off, .init = setup, .fini = teardown,
+   .description = "without dual smoothing, the pricers get the LP duals")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 1.0));
+   cr_assert_eq(nsmoothed, 0);
+   cr_assert_eq(scip->pricestore->nmispricings, 0);
+
+   /* every round adds the next column of the catalog, and the last round proves optimality */
+   cr_assert_eq(ncalls, NCOLUMNS + 1);
+}
+
+Test(smoothing, neame, .init = setup, .fini = teardown,
+   .description = "with dual smoothing, the pricers get smoothed duals and a mispricing is resolved with the LP duals")
+{
+   SCIP_CALL( SCIPsetRealParam(scip, "pricing/smoothing", 0.5) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 1.0));
+   cr_assert_gt(nsmoothed, 0);
+   cr_assert_eq(nbelow, 0);
+
+   /* optimality can only be proven by a pricing call with the LP duals after the smoothed duals found nothing */
+   cr_assert_geq(scip->pricestore->nmispricings, 1);
+   cr_assert_gt(ncalls, nsmoothed);
+}